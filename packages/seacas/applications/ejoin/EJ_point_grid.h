@@ -0,0 +1,168 @@
+// Copyright(C) 2010-2017 National Technology & Engineering Solutions
+// of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+// NTESS, the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of NTESS nor the names of its
+//       contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+#ifndef EJ_POINT_GRID_H
+#define EJ_POINT_GRID_H
+
+#include "EJ_CodeTypes.h" // for RealVector
+#include <algorithm>       // for max, min
+#include <cmath>           // for floor, pow
+#include <cstddef>         // for size_t
+#include <cstdint>         // for int64_t
+#include <vector>          // for vector
+
+// Uniform grid over a subset of the points in an interleaved (x,y,z)
+// coordinate array.  The grid spacing is at least `epsilon`, so every
+// point within `epsilon` (in any norm) of a query location lies in one
+// of the 27 cells surrounding the cell containing that location.  The
+// spacing is otherwise chosen so that there is about one point per
+// cell; directions in which all points have the same coordinate (e.g.
+// a planar interface) get a single layer of cells.
+//
+// Used for coordinate-based matching of nodes (or any other points
+// such as element centroids) between two parts.
+template <typename INT> class PointGrid
+{
+public:
+  PointGrid(const RealVector &coord, const std::vector<INT> &points, double epsilon)
+  {
+    if (points.empty()) {
+      return;
+    }
+
+    for (int d = 0; d < 3; d++) {
+      min_[d] = coord[3 * points[0] + d];
+    }
+    double max[3] = {min_[0], min_[1], min_[2]};
+    for (auto p : points) {
+      for (int d = 0; d < 3; d++) {
+        min_[d] = std::min(min_[d], coord[3 * p + d]);
+        max[d]  = std::max(max[d], coord[3 * p + d]);
+      }
+    }
+
+    // Spacing which gives about one point per cell over the non-degenerate directions.
+    double volume = 1.0;
+    int    dim    = 0;
+    for (int d = 0; d < 3; d++) {
+      if (max[d] > min_[d]) {
+        volume *= max[d] - min_[d];
+        dim++;
+      }
+    }
+    cellSize_ = dim > 0 ? std::pow(volume / points.size(), 1.0 / dim) : 1.0;
+    cellSize_ = std::max(cellSize_, epsilon);
+    if (!(cellSize_ > 0.0)) {
+      cellSize_ = 1.0;
+    }
+
+    // Bound the number of cells (clustered or very elongated point sets).
+    size_t max_cells = 8 * points.size() + 64;
+    for (;;) {
+      double cells = 1.0;
+      for (int d = 0; d < 3; d++) {
+        count_[d] = static_cast<int64_t>(std::floor((max[d] - min_[d]) / cellSize_)) + 1;
+        cells *= count_[d];
+      }
+      if (cells <= max_cells) {
+        break;
+      }
+      cellSize_ *= 2.0;
+    }
+
+    // Counting sort of the points by cell.
+    size_t              cell_count = count_[0] * count_[1] * count_[2];
+    std::vector<size_t> cell_of(points.size());
+    cellBegin_.assign(cell_count + 1, 0);
+    for (size_t i = 0; i < points.size(); i++) {
+      const double *xyz = &coord[3 * points[i]];
+      cell_of[i]        = cell(index(xyz, 0), index(xyz, 1), index(xyz, 2));
+      cellBegin_[cell_of[i] + 1]++;
+    }
+    for (size_t c = 0; c < cell_count; c++) {
+      cellBegin_[c + 1] += cellBegin_[c];
+    }
+    order_.resize(points.size());
+    std::vector<size_t> fill(cellBegin_.begin(), cellBegin_.end() - 1);
+    for (size_t i = 0; i < points.size(); i++) {
+      order_[fill[cell_of[i]]++] = i;
+    }
+  }
+
+  // Call `func(i)` for every point `points[i]` in the cells neighboring
+  // the location `xyz`.  The caller does the actual distance check.
+  template <typename FUNC> void visit_neighbors(const double *xyz, FUNC &func) const
+  {
+    if (order_.empty()) {
+      return;
+    }
+    int64_t lo[3];
+    int64_t hi[3];
+    for (int d = 0; d < 3; d++) {
+      int64_t i = index(xyz, d);
+      lo[d]     = std::max(i - 1, (int64_t)0);
+      hi[d]     = std::min(i + 1, count_[d] - 1);
+      if (lo[d] > hi[d]) {
+        return;
+      }
+    }
+    for (int64_t kx = lo[0]; kx <= hi[0]; kx++) {
+      for (int64_t ky = lo[1]; ky <= hi[1]; ky++) {
+        for (int64_t kz = lo[2]; kz <= hi[2]; kz++) {
+          size_t c = cell(kx, ky, kz);
+          for (size_t i = cellBegin_[c]; i < cellBegin_[c + 1]; i++) {
+            func(order_[i]);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  int64_t index(const double *xyz, int d) const
+  {
+    // Clamp far-away locations so the conversion to an integer is defined.
+    double offset = std::floor((xyz[d] - min_[d]) / cellSize_);
+    offset        = std::max(-2.0, std::min(offset, (double)count_[d] + 1));
+    return static_cast<int64_t>(offset);
+  }
+
+  size_t cell(int64_t ix, int64_t iy, int64_t iz) const
+  {
+    return (ix * count_[1] + iy) * count_[2] + iz;
+  }
+
+  double              min_[3]{};
+  double              cellSize_{1.0};
+  int64_t             count_[3]{1, 1, 1};
+  std::vector<size_t> cellBegin_;
+  std::vector<size_t> order_;
+};
+#endif
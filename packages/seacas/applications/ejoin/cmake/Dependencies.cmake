@@ -1,4 +1,6 @@
 TRIBITS_PACKAGE_DEFINE_DEPENDENCIES(
   LIB_REQUIRED_PACKAGES SEACASExodus SEACASIoss SEACASSuplibC SEACASSuplibCpp
+  LIB_OPTIONAL_TPLS Pthread
 )
 
+TRIBITS_TPL_TENTATIVELY_ENABLE(Pthread)
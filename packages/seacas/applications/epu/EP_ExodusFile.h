@@ -57,6 +57,7 @@ namespace Excn {
                 operator int() const;
     static int  max_name_length() { return maximumNameLength_; }
     static int  get_free_descriptor_count();
+    static const std::string &filename(int processor) { return filenames_[processor]; }
     static void unlink_temporary_files();
 
   private:
@@ -95,6 +95,10 @@ namespace Excn {
     bool int64() const { return intIs64Bit_; }
     void set_int64() const { intIs64Bit_ = true; }
     int  compress_data() const { return compressData_; }
+    int  thread_count() const { return threadCount_; }
+    bool follow() const { return follow_; }
+    int  follow_timeout() const { return followTimeout_; }
+    std::string follow_marker() const { return followMarker_; }
     bool subcycle_join() const { return subcycleJoin_; }
     bool output_shared_nodes() const { return outputSharedNodes_; }
     bool is_auto() const { return auto_; }
@@ -139,6 +143,7 @@ namespace Excn {
     std::string rootDirectory_{};
     std::string subDirectory_{};
     std::string basename_{};
+    std::string followMarker_{};
 
     // Used for a storage area only.  Needed for subcyle and auto-join option
     // Not directly settable through the user-interface (maybe should be?)
@@ -159,6 +164,8 @@ namespace Excn {
     int          cycle_{-1};
     int          compressData_{0};
     int          maxOpenFiles_{0};
+    int          threadCount_{0};
+    int          followTimeout_{60};
     bool         sumSharedNodes_{false};
     bool         addProcessorId_{false};
     bool         mapIds_{true};
@@ -171,6 +178,7 @@ namespace Excn {
     bool         outputSharedNodes_{false};
     bool         auto_{false};
     bool         keepTemporary_{false};
+    bool         follow_{false};
 
     StringIdVector globalVarNames_;
     StringIdVector nodeVarNames_;
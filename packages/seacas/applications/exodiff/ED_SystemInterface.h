@@ -82,6 +82,8 @@ public:
   std::pair<int, int> explicit_steps; // Only compare these two steps (db1:db2) if nonzero.
 
   int max_number_of_names{DEFAULT_MAX_NUMBER_OF_NAMES};
+  int num_threads{0}; // Threads used to read ahead, compare variables and match coordinates.
+  size_t memory_limit{0}; // Bytes of values read at one time; zero reads whole entities.
 
   std::vector<std::string> glob_var_names;
   Tolerance                glob_var_default{RELATIVE, 1.0e-6, 0.0};
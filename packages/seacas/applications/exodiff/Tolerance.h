@@ -35,6 +35,7 @@
 
 #include "map.h" // for MAP_TYPE_enum
 #include <cmath>
+#include <cstddef>
 
 // See http://realtimecollisiondetection.net/blog/?p=89 for a
 // description of the COMBINED tolerance.  Basically:
@@ -72,8 +73,20 @@ public:
 
   bool Diff(double v1, double v2) const;
 
+  // Largest |v1 - v2| for which Diff(v1, v2) can be false if |v1| and
+  // |v2| are at most `max_abs`, apart from two values below the (new
+  // definition of the) floor.  Negative if there is no such bound.
+  double MatchRange(double max_abs) const;
+
   double Delta(double v1, double v2) const;
 
+  // Array form of Delta() for `count` value pairs.  Returns the number
+  // of pairs whose Delta() exceeds `value`.  `max_delta` is the largest
+  // Delta() and `max_index` the first index at which it occurs; they are
+  // 0.0 and 0 if no Delta() is positive.
+  size_t Delta(const double *v1, const double *v2, size_t count, double &max_delta,
+               size_t &max_index) const;
+
   const char *typestr() const;
   const char *abrstr() const;
 
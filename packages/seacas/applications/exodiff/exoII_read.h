@@ -159,6 +159,14 @@ public:
   void          Free_Nodal_Results();
   void          Free_Nodal_Results(int var_index);
 
+  // Reads of `count` nodes starting at the (0-offset) node `start` into
+  // the caller's arrays, used to bound the memory with -memory_limit.
+  std::string Read_Partial_Coordinates(size_t start, size_t count, double *x, double *y,
+                                       double *z) const;
+  std::string Read_Partial_Nodal_Results(int t1, int t2, double proportion, int var_index,
+                                         size_t start, size_t count,
+                                         double *values) const; // Interpolated if t1 != t2
+
   // Global data:  (NOTE:  Global and Nodal data are always stored at the same
   //                       time step.  Therefore, if current time step number
   //                       is changed, the results will all be deleted.)
@@ -52,6 +52,10 @@ public:
   std::string Load_Connectivity();
   std::string Free_Connectivity();
 
+  // Reads the connectivity of `count` elements starting at the (0-offset)
+  // element `start` into the caller's array (used with -memory_limit).
+  std::string Read_Partial_Connectivity(size_t start, size_t count, INT *elmt_conn) const;
+
   // Access functions:
 
   const std::string &Elmt_Type() const { return elmt_type; }
@@ -75,6 +75,11 @@ public:
   std::string Load_Results(int time_step, int var_index);
   std::string Load_Results(int t1, int t2, double proportion, int var_index); // Interpolation
 
+  // Reads `count` values starting at the (0-offset) entry `start` into the
+  // caller's array, used to bound the memory with -memory_limit.
+  std::string Read_Partial_Results(int t1, int t2, double proportion, int var_index, size_t start,
+                                   size_t count, double *values) const; // Interpolated if t1 != t2
+
   const double *Get_Results(int var_index) const;
   void          Free_Results();
 
@@ -0,0 +1,174 @@
+// Copyright(C) 2008-2017 National Technology & Engineering Solutions
+// of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+// NTESS, the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of NTESS nor the names of its
+//       contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef EXODIFF_KD_TREE_H
+#define EXODIFF_KD_TREE_H
+
+#include "Tolerance.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Implicit k-d tree over a set of points given as separate x, y, z
+// arrays (`y` and `z` are nullptr for lower dimensions).  The points
+// are reordered so that the point at the middle of each range splits
+// the range in the direction of its largest extent; ranges of up to
+// `leaf_size` points are not split.  Unlike a sort along a single
+// coordinate, the searches do not degenerate when many points share
+// the same coordinate (structured meshes), and unlike a uniform grid,
+// they do not degenerate for strongly graded meshes.
+class KdTree
+{
+public:
+  KdTree(const double *x, const double *y, const double *z, size_t count, int thread_count);
+
+  // Find the points matching `xyz` within `tol` in each coordinate;
+  // `range` is tol.MatchRange() for the coordinates of the points and
+  // `xyz`.  Returns the number of matches; `first` and `second` are
+  // the matches with the lowest `rank` (-1 if none).
+  template <typename INT>
+  size_t find(const Tolerance &tol, double range, const double xyz[3], const INT *rank,
+              INT &first, INT &second) const
+  {
+    // Widen the box by the rounding of the coordinate differences and,
+    // if `xyz` is below the floor, to all values below the floor.
+    double lo[3];
+    double hi[3];
+    for (int d = 0; d < 3; d++) {
+      double reach = range + 16.0 * DBL_EPSILON * (maxAbs_ + std::fabs(xyz[d]));
+      lo[d]        = xyz[d] - reach;
+      hi[d]        = xyz[d] + reach;
+      if (!Tolerance::use_old_floor && std::fabs(xyz[d]) <= tol.floor) {
+        lo[d] = std::min(lo[d], -tol.floor);
+        hi[d] = std::max(hi[d], tol.floor);
+      }
+    }
+
+    size_t matches = 0;
+    first          = -1;
+    second         = -1;
+    auto check     = [&](size_t k) {
+      for (int d = 0; d < dim_; d++) {
+        if (tol.Diff(at(k)[d], xyz[d])) {
+          return;
+        }
+      }
+      matches++;
+      INT r = rank[order_[k]];
+      if (first < 0 || r < first) {
+        second = first;
+        first  = r;
+      }
+      else if (second < 0 || r < second) {
+        second = r;
+      }
+    };
+    visit_box(0, order_.size(), lo, hi, check);
+    return matches;
+  }
+
+  // Squared distance of the closest pair of points, computed as the sum
+  // of the squared coordinate differences in x, y, z order.
+  double closest_pair(int thread_count) const;
+
+private:
+  static const size_t leaf_size = 8;
+
+  void build(size_t lo, size_t hi, int thread_count);
+  void select(size_t lo, size_t hi, size_t mid, int d);
+  void swap(size_t k, size_t l);
+
+  // Coordinates of the point at tree position `k` (0 for the missing directions).
+  const double *at(size_t k) const { return &xyz_[3 * k]; }
+
+  bool inside(size_t k, const double lo[3], const double hi[3]) const
+  {
+    const double *p = at(k);
+    return p[0] >= lo[0] && p[0] <= hi[0] && p[1] >= lo[1] && p[1] <= hi[1] && p[2] >= lo[2] &&
+           p[2] <= hi[2];
+  }
+
+  // Call `func(k)` for every tree position `k` in [lo, hi) inside the box.
+  template <typename FUNC>
+  void visit_box(size_t lo, size_t hi, const double box_lo[3], const double box_hi[3],
+                 FUNC &func) const
+  {
+    while (hi - lo > leaf_size) {
+      size_t mid   = lo + (hi - lo) / 2;
+      int    d     = split_[mid];
+      double split = at(mid)[d];
+      if (inside(mid, box_lo, box_hi)) {
+        func(mid);
+      }
+      // Points before `mid` are not above the split, points after it not below.
+      if (box_lo[d] <= split) {
+        if (box_hi[d] >= split) {
+          visit_box(mid + 1, hi, box_lo, box_hi, func);
+        }
+        hi = mid;
+      }
+      else {
+        lo = mid + 1;
+      }
+    }
+    for (size_t k = lo; k < hi; k++) {
+      if (inside(k, box_lo, box_hi)) {
+        func(k);
+      }
+    }
+  }
+
+  void closest(size_t lo, size_t hi, size_t k, double &dist) const;
+
+  double distance(size_t k, size_t l) const
+  {
+    const double *p = at(k);
+    const double *q = at(l);
+    return (q[0] - p[0]) * (q[0] - p[0]) + (q[1] - p[1]) * (q[1] - p[1]) +
+           (q[2] - p[2]) * (q[2] - p[2]);
+  }
+
+  int                 dim_{0};
+  double              maxAbs_{0.0};
+  std::vector<size_t> order_; // point at each tree position
+  std::vector<char>   split_; // split direction at each tree position
+  std::vector<double> xyz_;   // coordinates in tree order
+};
+
+// Minimum distance between any two of the `count` points, computed
+// with up to `thread_count` threads.  Gives exactly the same result as
+// comparing all pairs.
+double min_point_separation(const double *x, const double *y, const double *z, size_t count,
+                            int thread_count);
+#endif
@@ -33,6 +33,8 @@
 #ifndef EXODIFF_MAP_H
 #define EXODIFF_MAP_H
 #include "exoII_read.h"
+#include <algorithm>
+#include <vector>
 
 enum MAP_TYPE_enum { FILE_ORDER = 0, PARTIAL, USE_FILE_IDS, DISTANCE };
 
@@ -54,6 +56,54 @@ template <typename INT>
 bool Check_Maps(const INT *node_map, const INT *elmt_map, const ExoII_Read<INT> &file1,
                 const ExoII_Read<INT> &file2);
 
+// A sorted sub-range [first, last) of the file 2 entries that a chunk of file 1
+// entries maps to; order[begin], ..., order[end - 1] are the offsets in the chunk
+// of the entries mapping into it.
+struct Mapped_Run
+{
+  size_t first;
+  size_t last;
+  size_t begin;
+  size_t end;
+};
+
+// Splits the non-negative values among map[start], ..., map[start + count - 1]
+// into runs which each span at most `count` file 2 entries and skip at most
+// `max_gap` unmapped entries between mapped ones.  A run then fits in the
+// chunk's memory and the values read for a chunk stay linear in `count` even
+// when the map scatters it over the whole of file 2; the gap only trades
+// extra values read for fewer reads.
+template <typename INT>
+void Mapped_Runs(const INT *map, size_t start, size_t count, std::vector<size_t> &order,
+                 std::vector<Mapped_Run> &runs, size_t max_gap = 1024)
+{
+  order.clear();
+  runs.clear();
+  for (size_t i = 0; i < count; i++) {
+    if (map[start + i] >= 0) {
+      order.push_back(i);
+    }
+  }
+  std::sort(order.begin(), order.end(),
+            [&](size_t a, size_t b) { return map[start + a] < map[start + b]; });
+
+  size_t begin = 0;
+  while (begin < order.size()) {
+    size_t first = map[start + order[begin]];
+    size_t last  = first + 1;
+    size_t end   = begin + 1;
+    for (; end < order.size(); end++) {
+      size_t id = map[start + order[end]];
+      if (id + 1 - first > count || id > last + max_gap) {
+        break;
+      }
+      last = id + 1;
+    }
+    runs.push_back(Mapped_Run{first, last, begin, end});
+    begin = end;
+  }
+}
+
 template <typename INT>
 bool Compare_Maps(ExoII_Read<INT> &file1, ExoII_Read<INT> &file2, const INT *node_map,
                   const INT *elmt_map, bool partial_flag);
@@ -36,6 +36,10 @@
 #define EXODIFF_UTIL_H
 
 #include "terminal_color.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 char **get_name_array(int size, int length);
 void   free_name_array(char **names, int size);
@@ -44,4 +48,36 @@ void ERR_OUT(std::ostringstream &buf);
 void DIFF_OUT(std::ostringstream &buf, trmclr::Style color = trmclr::red);
 void DIFF_OUT(const char *buf, trmclr::Style color = trmclr::red);
 
+// Number of items, at most `count`, that can be held at one time if each
+// uses `bytes_per_item` bytes and `memory_limit` bytes are allowed.  All
+// `count` items if `memory_limit` is zero.
+size_t chunk_size(size_t memory_limit, size_t bytes_per_item, size_t count);
+
+// Call `func(i)` for each `i` in [0, count) using up to `thread_count`
+// threads.  The netcdf library is not thread-safe, so `func` must not
+// make any exodus calls.
+template <typename FUNC> void parallel_for(int thread_count, size_t count, FUNC func)
+{
+  size_t threads_used = std::min((size_t)std::max(thread_count, 1), count);
+  if (threads_used <= 1) {
+    for (size_t i = 0; i < count; i++) {
+      func(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t>      next{0};
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < threads_used; t++) {
+    threads.emplace_back([&]() {
+      for (size_t i = next++; i < count; i = next++) {
+        func(i);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
 #endif
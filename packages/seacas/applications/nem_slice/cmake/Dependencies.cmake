@@ -1,5 +1,8 @@
 TRIBITS_PACKAGE_DEFINE_DEPENDENCIES(
   LIB_REQUIRED_PACKAGES SEACASExodus SEACASChaco SEACASSuplibC SEACASSuplibCpp
   LIB_OPTIONAL_PACKAGES Zoltan
+  LIB_OPTIONAL_TPLS Pthread
 )
 
+TRIBITS_TPL_TENTATIVELY_ENABLE(Pthread)
+
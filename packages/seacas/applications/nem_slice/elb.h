@@ -37,6 +37,7 @@
 #define _EXOIILB_CONST_H_
 
 #include "elb_elem.h"
+#include "elb_scratch.h"
 #include <cstdio>
 #include <exodusII.h>
 #include <string>
@@ -151,14 +152,18 @@ struct Problem_Description
   char *groups;
   int * group_no;
   int   num_groups;
-  int   int64db;  /* integer types for output mesh database */
-  int   int64api; /* integer types for exodus api calls */
+  int   int64db;     /* integer types for output mesh database */
+  int   int64api;    /* integer types for exodus api calls */
+  int   num_threads; /* threads used to build the graph */
+
+  std::string scratch_dir; /* directory for memory-mapped graph arrays */
 
   Problem_Description()
       : type(-1), read_coords(-1), coarse_flag(-1), alloc_graph(-1), num_vertices(0), vis_out(-1),
         skip_checks(-1), face_adj(-1), partial_adj(0), global_mech(-1), local_mech(-1),
         find_cnt_domains(-1), mech_add_procs(-1), dsd_add_procs(-1), no_sph(-1), fix_columns(0),
-        groups(nullptr), group_no(nullptr), num_groups(-1), int64db(0), int64api(0)
+        groups(nullptr), group_no(nullptr), num_groups(-1), int64db(0), int64api(0),
+        num_threads(1)
   {
   }
 };
@@ -196,8 +201,8 @@ template <typename INT> struct Weight_Description
   /* vector to indicate if weight value has already been overwritten */
   std::vector<INT> ow;
 
-  std::vector<int>   vertices;
-  std::vector<float> edges;
+  std::vector<int>     vertices;
+  Scratch_Array<float> edges;
 
   Weight_Description<INT>() : type(-1), ow_read(0), exo_tindx(-1), exo_vindx(-1), nvals(0) {}
 };
@@ -238,14 +243,51 @@ struct Sphere_Info
   Sphere_Info() : num(0), adjust(nullptr), begin(nullptr), end(nullptr) {}
 };
 
+/* The elements surrounding each node, stored as one array of element
+ * indices and the offset of the list of each node into it. */
+template <typename INT> struct Surround_Elements
+{
+  /* The list of a single node */
+  class List
+  {
+  public:
+    List(const INT *data, size_t size) : data_(data), size_(size) {}
+    size_t     size() const { return size_; }
+    bool       empty() const { return size_ == 0; }
+    const INT *data() const { return data_; }
+    const INT *begin() const { return data_; }
+    const INT *end() const { return data_ + size_; }
+    const INT &operator[](size_t i) const { return data_[i]; }
+
+  private:
+    const INT *data_;
+    size_t     size_;
+  };
+
+  Scratch_Array<size_t> offsets; /* num_nodes + 1 entries */
+  Scratch_Array<INT>    elems;
+
+  List   operator[](size_t node) const
+  {
+    return List(elems.data() + offsets[node], offsets[node + 1] - offsets[node]);
+  }
+  size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+  bool   empty() const { return offsets.empty(); }
+  void   clear()
+  {
+    offsets.clear();
+    elems.clear();
+  }
+};
+
 /* Structure used to store various information about the graph */
 template <typename INT> struct Graph_Description
 {
-  size_t                        nadj;
-  int                           max_nsur;
-  std::vector<INT>              adj;
-  std::vector<INT>              start;
-  std::vector<std::vector<INT>> sur_elem;
+  size_t                 nadj;
+  int                    max_nsur;
+  Scratch_Array<INT>     adj;
+  Scratch_Array<INT>     start;
+  Surround_Elements<INT> sur_elem;
   Graph_Description<INT>() : nadj(0), max_nsur(0) {}
 };
 
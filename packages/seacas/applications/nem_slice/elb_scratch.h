@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2009-2017 National Technology & Engineering Solutions of
+ * Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above
+ *       copyright notice, this list of conditions and the following
+ *       disclaimer in the documentation and/or other materials provided
+ *       with the distribution.
+ *
+ *     * Neither the name of NTESS nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _ELB_SCRATCH_H_
+#define _ELB_SCRATCH_H_
+
+#include <algorithm> // for copy, fill, max
+#include <cstddef>   // for size_t
+#include <string>    // for string
+
+/*
+ * Directory in which the graph arrays are kept in memory-mapped
+ * scratch files.  If empty, the arrays are allocated on the heap.
+ */
+void set_scratch_directory(const std::string &directory);
+
+/*
+ * Resizes 'data' from 'old_bytes' to 'new_bytes', keeping its contents.
+ * 'fd' is the descriptor of the scratch file backing the array, -1 for
+ * an array on the heap.  On failure, reports the error and exits.
+ */
+void *scratch_resize(void *data, size_t old_bytes, size_t new_bytes, int &fd);
+void  scratch_free(void *data, size_t bytes, int &fd);
+
+/*
+ * A minimal vector of trivially copyable values whose storage is a
+ * memory-mapped scratch file if a scratch directory is set.  The file is
+ * removed as soon as it is created, so the operating system can page the
+ * array out to it instead of to swap, and it disappears with the process.
+ */
+template <typename T> class Scratch_Array
+{
+public:
+  Scratch_Array() = default;
+  Scratch_Array(const Scratch_Array &) = delete;
+  Scratch_Array &operator=(const Scratch_Array &) = delete;
+  ~Scratch_Array() { clear(); }
+
+  void reserve(size_t count)
+  {
+    if (count > capacity_) {
+      data_     = (T *)scratch_resize(data_, capacity_ * sizeof(T), count * sizeof(T), fd_);
+      capacity_ = count;
+    }
+  }
+
+  void resize(size_t count)
+  {
+    reserve(count);
+    if (count > size_) {
+      std::fill(data_ + size_, data_ + count, T());
+    }
+    size_ = count;
+  }
+
+  /* Appends [first, last), growing the capacity geometrically */
+  void append(const T *first, const T *last)
+  {
+    size_t count = last - first;
+    if (size_ + count > capacity_) {
+      reserve(std::max(size_ + count, 2 * capacity_));
+    }
+    std::copy(first, last, data_ + size_);
+    size_ += count;
+  }
+
+  void clear()
+  {
+    scratch_free(data_, capacity_ * sizeof(T), fd_);
+    data_     = nullptr;
+    size_     = 0;
+    capacity_ = 0;
+  }
+
+  size_t   size() const { return size_; }
+  bool     empty() const { return size_ == 0; }
+  T *      data() { return data_; }
+  const T *data() const { return data_; }
+  T *      begin() { return data_; }
+  T *      end() { return data_ + size_; }
+  T &      operator[](size_t i) { return data_[i]; }
+  const T &operator[](size_t i) const { return data_[i]; }
+
+private:
+  T *    data_{nullptr};
+  size_t size_{0};
+  size_t capacity_{0};
+  int    fd_{-1};
+};
+
+template <typename T> void vec_free(Scratch_Array<T> &V) { V.clear(); }
+
+#endif /* _ELB_SCRATCH_H_ */
@@ -40,6 +40,8 @@
 #include "pe_str_util_const.h" // for strip_string, token_compare, etc
 #include "rf_allo.h"
 #include "rf_io_const.h"
+#include <functional>
+#include <vector>
 
 #define UTIL_NAME "nem_spread"
 #define VER_STR "6.16 (2016/08/25)"
@@ -47,6 +49,16 @@
 extern void   check_exodus_error(int, const char *);
 extern double second(void);
 
+/* Calls write_file(iproc) for iproc in [start, start+count) using up to
+ * num_writers concurrent writer processes; the time spent on each file
+ * is returned in file_time.  Returns true if the files were written by
+ * separate processes, in which case changes write_file makes to memory
+ * are not seen by the caller. */
+extern bool write_files_concurrently(int start, int count, int num_writers,
+                                     const std::function<void(int)> &write_file,
+                                     std::vector<double> &file_time);
+extern void report_file_times(const char *what, int start, const std::vector<double> &file_time);
+
 template <typename T, typename INT> class NemSpread
 {
 public:
@@ -117,7 +129,8 @@ public:
 
   int  int64db;
   int  int64api;
-  bool force64db; /* Store all ints as 64-bit on output databases. */
+  bool force64db;   /* Store all ints as 64-bit on output databases. */
+  int  num_writers; /* Number of processor files written concurrently. */
 
   int                    io_ws;
   Restart_Description<T> Restart_Info;
@@ -183,11 +196,12 @@ public:
   int *Proc_Ids;
 
   NemSpread()
-      : int64db(0), int64api(0), force64db(false), io_ws(0), Node_Set_Ids(nullptr),
-        Side_Set_Ids(nullptr), Num_Elem_In_Blk(nullptr), Num_Nodes_Per_Elem(nullptr),
-        Num_Attr_Per_Elem(nullptr), Elem_Blk_Ids(nullptr), Elem_Blk_Types(nullptr),
-        Elem_Blk_Names(nullptr), Node_Set_Names(nullptr), Side_Set_Names(nullptr),
-        Elem_Blk_Attr_Names(nullptr), GM_Elem_Types(nullptr), Proc_Ids(nullptr)
+      : int64db(0), int64api(0), force64db(false), num_writers(1), io_ws(0),
+        Node_Set_Ids(nullptr), Side_Set_Ids(nullptr), Num_Elem_In_Blk(nullptr),
+        Num_Nodes_Per_Elem(nullptr), Num_Attr_Per_Elem(nullptr), Elem_Blk_Ids(nullptr),
+        Elem_Blk_Types(nullptr), Elem_Blk_Names(nullptr), Node_Set_Names(nullptr),
+        Side_Set_Names(nullptr), Elem_Blk_Attr_Names(nullptr), GM_Elem_Types(nullptr),
+        Proc_Ids(nullptr)
   {
     Coord_Name[0] = Coord_Name[1] = Coord_Name[2] = nullptr;
     Proc_Info[0] = Proc_Info[1] = Proc_Info[2] = Proc_Info[3] = Proc_Info[4] = Proc_Info[5] = 0;
@@ -0,0 +1,60 @@
+// Copyright(C) 2016-2017 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+// NTESS, the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+//
+// * Neither the name of NTESS nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef SL_Decompose_h
+#define SL_Decompose_h
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Geometric decomposition of the elements using their centroids.
+// These do not need an external partitioning library.
+//
+// The methods are:
+//  * 'rcb'    -- recursive coordinate bisection
+//  * 'rib'    -- recursive inertial bisection
+//  * 'hsfc'   -- order the elements along a Hilbert space-filling curve
+//  * 'morton' -- order the elements along a Morton (Z-order) curve
+//
+// Every method gives each processor the same number of elements as the
+// 'linear' method.  The result does not depend on the thread count.
+
+// True if 'method' is one of the methods above.
+bool is_geometric_method(const std::string &method);
+
+// Sets 'elem_to_proc' to the processor of each element for 'method',
+// using up to 'thread_count' threads.  'centroids' holds x, y, z for
+// each element (z is zero for 2D meshes).
+void decompose_geometric(const std::string &method, size_t proc_count, int thread_count,
+                         const std::vector<double> &centroids, std::vector<int> &elem_to_proc);
+#endif
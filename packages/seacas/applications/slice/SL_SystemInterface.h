@@ -64,6 +64,8 @@ public:
 
   size_t partial() const { return partialReadCount_; }
   bool   contiguous_decomposition() const { return contig_; }
+  size_t writer_count() const { return writerCount_; }
+  int    thread_count() const { return threadCount_; }
 
   const StringIdVector &global_var_names() const { return globalVarNames_; }
   const StringIdVector &node_var_names() const { return nodeVarNames_; }
@@ -107,6 +109,8 @@ private:
 
   size_t partialReadCount_;
   int    processorCount_;
+  int    writerCount_;
+  int    threadCount_;
   int    debugLevel_;
   int    screenWidth_;
   int    stepMin_;
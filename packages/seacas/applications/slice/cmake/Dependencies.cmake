@@ -1,5 +1,7 @@
 TRIBITS_PACKAGE_DEFINE_DEPENDENCIES(
   LIB_REQUIRED_PACKAGES SEACASExodus SEACASIoss SEACASSuplibC SEACASSuplibCpp
-  LIB_OPTIONAL_TPLS METIS
+  LIB_OPTIONAL_TPLS METIS Pthread
 )
 
+TRIBITS_TPL_TENTATIVELY_ENABLE(Pthread)
+
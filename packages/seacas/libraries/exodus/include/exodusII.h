@@ -237,8 +237,10 @@ enum ex_option_type {
   EX_OPT_COMPRESSION_LEVEL,   /**<  In the range [0..9]. A value of 0 indicates no compression */
   EX_OPT_COMPRESSION_SHUFFLE, /**<  1 if enabled, 0 if disabled	*/
   EX_OPT_INTEGER_SIZE_API, /**<  4 or 8 indicating byte size of integers used in api functions. */
-  EX_OPT_INTEGER_SIZE_DB /**<  Query only, returns 4 or 8 indicating byte size of integers stored on
-                            the database. */
+  EX_OPT_INTEGER_SIZE_DB, /**<  Query only, returns 4 or 8 indicating byte size of integers stored
+                            on the database. */
+  EX_OPT_TIME_HISTORY     /**<  1 to write a time-history copy of the results variables (see
+                            ex_put_time_history()) when the file is closed; 0 (default) to not. */
 };
 typedef enum ex_option_type ex_option_type;
 /*@}*/
@@ -415,6 +417,15 @@ typedef struct ex_var_params
   int *sset_var_tab;
   int *elset_var_tab;
 } ex_var_params;
+
+typedef struct ex_var_data
+{
+  int64_t     id;
+  int         var_index;
+  int64_t     start_index;
+  int64_t     num_entry;
+  const void *values;
+} ex_var_data;
 /* @} */
 
 #ifndef EXODUS_EXPORT
@@ -789,6 +800,10 @@ EXODUS_EXPORT int ex_put_partial_var(int exoid, int time_step, ex_entity_type va
                                      int var_index, ex_entity_id obj_id, int64_t start_index,
                                      int64_t num_entities, const void *var_vals);
 
+/*  Write Several Nodal, Edge, Face, or Element Variables on Blocks or Sets at a Time Step */
+EXODUS_EXPORT int ex_put_vars(int exoid, int time_step, ex_entity_type var_type, size_t var_count,
+                              const struct ex_var_data *vars);
+
 /*  Read Edge Face or Element Variable Values Defined On Blocks or Sets at a Time Step */
 EXODUS_EXPORT int ex_get_var(int exoid, int time_step, ex_entity_type var_type, int var_index,
                              ex_entity_id obj_id, int64_t num_entry_this_obj, void *var_vals);
@@ -801,6 +816,9 @@ EXODUS_EXPORT int ex_get_partial_var(int exoid, int time_step, ex_entity_type va
 EXODUS_EXPORT int ex_get_var_time(int exoid, ex_entity_type var_type, int var_index, int64_t id,
                                   int beg_time_step, int end_time_step, void *var_vals);
 
+/*  Write a Time-Major Copy of all Results Variables for Fast ex_get_var_time() Access */
+EXODUS_EXPORT int ex_put_time_history(int exoid);
+
 EXODUS_EXPORT int ex_cvt_nodes_to_sides(int exoid, void_int *num_elem_per_set,
                                         void_int *num_nodes_per_set, void_int *side_sets_elem_index,
                                         void_int *side_sets_node_index,
@@ -245,6 +245,10 @@ EXODUS_EXPORT int indent;
 /* and earlier               */
 #define ATT_MAX_NAME_LENGTH "maximum_name_length"
 #define ATT_INT64_STATUS "int64_status"
+#define ATT_TIME_HIST_VALID "time_history_valid_steps" /* # of leading steps  */
+                                                   /*   which still match */
+                                                   /*   the time-history  */
+                                                   /*   copies            */
 
 #define DIM_NUM_NODES "num_nodes"     /* # of nodes                */
 #define DIM_NUM_DIM "num_dim"         /* # of dimensions; 2- or 3-d*/
@@ -585,6 +589,10 @@ EXODUS_EXPORT int indent;
 #define DIM_TIME "time_step"            /* unlimited (expandable)    */
                                         /*   dimension for time steps*/
 #define DIM_HTIME "hist_time_step"      /* obsolete                  */
+#define DIM_TIME_HIST "time_history_step" /* # of time steps in the  */
+                                          /*   time-history copies   */
+#define VAR_HIST_SUFFIX "_hist"         /* suffix of the time-history*/
+                                        /*   copy of a results var   */
 #define VAR_ELEM_NUM_MAP "elem_num_map" /* element numbering map     */
                                         /* obsolete, replaced by     */
                                         /* VAR_ELEM_MAP(num)         */
@@ -707,6 +715,15 @@ typedef enum ex_coordinate_frame_type ex_coordinate_frame_type;
 
 /* Internal structure declarations */
 
+struct ex_varid_cache_entry
+{
+  int exoid; /* 0 if entry is unused; otherwise file or group id */
+  int var_type;
+  int obj_id_ndx;
+  int var_index;
+  int varid;
+};
+
 struct ex_file_item
 {
   int     file_id;
@@ -714,6 +731,10 @@ struct ex_file_item
   int     int64_status;
   int     maximum_name_length;
   int     time_varid; /* Store to avoid lookup each timestep */
+  int     time_hist_steps; /* # of steps the time-history copy is valid for; 0 if none */
+  struct ex_varid_cache_entry *varid_cache; /* open-addressed hash of results variable ids */
+  size_t                       varid_cache_size;  /* capacity; power of 2 or 0 */
+  size_t                       varid_cache_count; /* number of used entries */
   unsigned int
                compression_level : 4; /* 0 (disabled) to 9 (maximum) compression level; netcdf-4 only */
   unsigned int user_compute_wordsize : 1; /* 0 for 4 byte or 1 for 8 byte reals */
@@ -727,6 +748,7 @@ struct ex_file_item
   unsigned int         has_edges : 1;   /* for input only at this time */
   unsigned int         has_faces : 1;   /* for input only at this time */
   unsigned int         has_elems : 1;   /* for input only at this time */
+  unsigned int         time_history : 1; /* 1 to call ex_put_time_history() in ex_close() */
   struct ex_file_item *next;
 };
 
@@ -750,10 +772,19 @@ struct list_item
   struct list_item *next;
 };
 
+struct list_table
+{ /* list_items hashed on exodus file id; buckets are chained via `next` */
+  struct list_item **buckets;
+  size_t             size;
+  size_t             count;
+};
+
 struct obj_stats
 {
   int64_t *         id_vals;
   int *             stat_vals;
+  size_t *          id_index;      /* open-addressed hash of id_vals; stores index+1, 0 if empty */
+  size_t            id_index_size; /* power of two; 0 until valid_ids is set */
   long              num;
   int               exoid;
   int               valid_ids;
@@ -761,6 +792,13 @@ struct obj_stats
   struct obj_stats *next;
 };
 
+struct obj_stats_table
+{ /* obj_stats hashed on exodus file id; buckets are chained via `next` */
+  struct obj_stats **buckets;
+  size_t             size;
+  size_t             count;
+};
+
 void ex_iqsort(int v[], int iv[], int N);
 void ex_iqsort64(int64_t v[], int64_t iv[], int64_t N);
 
@@ -780,29 +818,38 @@ int     ex_comp_ws(int exoid);
 int     ex_get_cpu_ws(void);
 int     ex_is_parallel(int exoid);
 
-struct list_item **ex_get_counter_list(ex_entity_type obj_type);
-int                ex_get_file_item(int /*exoid*/, struct list_item ** /*list_ptr*/);
-int                ex_inc_file_item(int /*exoid*/, struct list_item ** /*list_ptr*/);
-void               ex_rm_file_item(int /*exoid*/, struct list_item ** /*list_ptr*/);
-
-extern struct obj_stats *exoII_eb;
-extern struct obj_stats *exoII_ed;
-extern struct obj_stats *exoII_fa;
-extern struct obj_stats *exoII_ns;
-extern struct obj_stats *exoII_es;
-extern struct obj_stats *exoII_fs;
-extern struct obj_stats *exoII_ss;
-extern struct obj_stats *exoII_els;
-extern struct obj_stats *exoII_em;
-extern struct obj_stats *exoII_edm;
-extern struct obj_stats *exoII_fam;
-extern struct obj_stats *exoII_nm;
+size_t ex_hash_file_id(int exoid);
+
+struct list_table *ex_get_counter_list(ex_entity_type obj_type);
+int                ex_get_file_item(int /*exoid*/, struct list_table * /*list_ptr*/);
+int                ex_inc_file_item(int /*exoid*/, struct list_table * /*list_ptr*/);
+void               ex_rm_file_item(int /*exoid*/, struct list_table * /*list_ptr*/);
+
+extern struct obj_stats_table exoII_eb;
+extern struct obj_stats_table exoII_ed;
+extern struct obj_stats_table exoII_fa;
+extern struct obj_stats_table exoII_ns;
+extern struct obj_stats_table exoII_es;
+extern struct obj_stats_table exoII_fs;
+extern struct obj_stats_table exoII_ss;
+extern struct obj_stats_table exoII_els;
+extern struct obj_stats_table exoII_em;
+extern struct obj_stats_table exoII_edm;
+extern struct obj_stats_table exoII_fam;
+extern struct obj_stats_table exoII_nm;
 
 struct ex_file_item *ex_find_file_item(int exoid);
 struct ex_file_item *ex_add_file_item(int exoid);
-struct obj_stats *   ex_get_stat_ptr(int exoid, struct obj_stats **obj_ptr);
 
-void ex_rm_stat_ptr(int exoid, struct obj_stats **obj_ptr);
+int  ex_get_varid_of_object(int exoid, ex_entity_type var_type, int var_index, int obj_id_ndx,
+                            int *varid);
+void ex_set_cached_varid(int exoid, ex_entity_type var_type, int obj_id_ndx, int var_index,
+                         int varid);
+int  ex_get_time_history_varid(int exoid, int varid, int *hist_varid, size_t *hist_steps);
+void ex_invalidate_time_history(int exoid, int time_step);
+struct obj_stats *   ex_get_stat_ptr(int exoid, struct obj_stats_table *obj_ptr);
+
+void ex_rm_stat_ptr(int exoid, struct obj_stats_table *obj_ptr);
 
 void ex_compress_variable(int exoid, int varid, int type);
 int  ex_id_lkup(int exoid, ex_entity_type id_type, ex_entity_id num);
@@ -818,6 +865,9 @@ int ex_get_nodal_var_int(int exoid, int time_step, int nodal_var_index, int64_t
 int ex_put_nodal_var_int(int exoid, int time_step, int nodal_var_index, int64_t num_nodes,
                          const void *nodal_var_vals);
 
+int ex_look_up_var_id(int exoid, ex_entity_type var_type, int var_index, ex_entity_id obj_id,
+                      int *varid);
+
 int ex_get_nodal_var_time_int(int exoid, int nodal_var_index, int64_t node_number,
                               int beg_time_step, int end_time_step, void *nodal_var_vals);
 
@@ -103,6 +103,14 @@ int ex_close(int exoid)
   }
 #endif
 
+  {
+    struct ex_file_item *file = ex_find_file_item(exoid);
+    if (file != NULL && file->time_history) {
+      /* Any failure is reported by ex_put_time_history(); still close the file. */
+      ex_put_time_history(exoid);
+    }
+  }
+
   if ((status1 = nc_sync(exoid)) != NC_NOERR) {
     snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: failed to update file id %d", exoid);
     ex_err(__func__, errmsg, status1);
@@ -48,6 +48,7 @@
 #include "exodusII.h"     // for ex_err, etc
 #include "exodusII_int.h" // for ex_file_item, EX_FATAL, etc
 #include "netcdf.h"       // for nc_inq_format, nc_type, etc
+#include <stdint.h> // for uint64_t
 #include <stdio.h>
 #include <stdlib.h> // for NULL, free, malloc
 
@@ -65,13 +66,56 @@
 
 #define NC_FLOAT_WORDSIZE 4
 
-static struct ex_file_item *file_list = NULL;
+/*
+ * Open files hashed on their base (root group) file id.  Every API call
+ * goes through ex_find_file_item(), so with many files open a linear
+ * walk of a single list becomes a noticeable cost.  Buckets are chained
+ * through ex_file_item::next and the table doubles when the number of
+ * files reaches the number of buckets.
+ */
+static struct ex_file_item **file_table      = NULL;
+static size_t                file_table_size = 0;
+static size_t                file_count      = 0;
+
+static struct ex_file_item **ex_file_bucket(int base_exoid)
+{
+  return &file_table[ex_hash_file_id(base_exoid) & (file_table_size - 1)];
+}
+
+static void ex_grow_file_table(void)
+{
+  size_t                i;
+  size_t                new_size = file_table_size == 0 ? 16 : 2 * file_table_size;
+  struct ex_file_item **buckets  = calloc(new_size, sizeof(struct ex_file_item *));
+  if (buckets == NULL) {
+    return; /* keep the current table; chains are just longer */
+  }
+
+  for (i = 0; i < file_table_size; i++) {
+    struct ex_file_item *ptr = file_table[i];
+    while (ptr) {
+      struct ex_file_item *next = ptr->next;
+      size_t               slot = ex_hash_file_id(ptr->file_id) & (new_size - 1);
+      ptr->next                 = buckets[slot];
+      buckets[slot]             = ptr;
+      ptr                       = next;
+    }
+  }
+  free(file_table);
+  file_table      = buckets;
+  file_table_size = new_size;
+}
 
 struct ex_file_item *ex_find_file_item(int exoid)
 {
   /* Find base filename in case exoid refers to a group */
   int                  base_exoid = (unsigned)exoid & EX_FILE_ID_MASK;
-  struct ex_file_item *ptr        = file_list;
+  struct ex_file_item *ptr        = NULL;
+  if (file_table_size == 0) {
+    return (NULL);
+  }
+
+  ptr = *ex_file_bucket(base_exoid);
   while (ptr) {
     if (ptr->file_id == base_exoid) {
       break;
@@ -81,6 +125,135 @@ struct ex_file_item *ex_find_file_item(int exoid)
   return (ptr);
 }
 
+/*
+ * Cache of netcdf variable ids for results variables.  Building the
+ * variable name (ex_name_var_of_object) and looking it up with
+ * nc_inq_varid is a significant fraction of the cost of reading or
+ * writing a small block variable.  NetCDF never renumbers an existing
+ * variable and only successful lookups are stored, so an entry stays
+ * valid until the file is closed.  The key includes the full `exoid`
+ * since group ids share the file item of their root file.
+ */
+static size_t ex_varid_cache_hash(int exoid, int var_type, int obj_id_ndx, int var_index)
+{
+  uint64_t key = ((uint64_t)(unsigned)exoid * 0x9E3779B97F4A7C15ULL) ^
+                 ((uint64_t)(unsigned)var_type << 56) ^ ((uint64_t)(unsigned)obj_id_ndx << 24) ^
+                 (uint64_t)(unsigned)var_index;
+  key *= 0xBF58476D1CE4E5B9ULL;
+  return (size_t)(key ^ (key >> 31));
+}
+
+static int ex_get_cached_varid(int exoid, ex_entity_type var_type, int obj_id_ndx, int var_index)
+{
+  struct ex_file_item *file = ex_find_file_item(exoid);
+  size_t               mask, i;
+
+  if (file == NULL || file->varid_cache_size == 0) {
+    return -1;
+  }
+
+  mask = file->varid_cache_size - 1;
+  i    = ex_varid_cache_hash(exoid, var_type, obj_id_ndx, var_index) & mask;
+  for (;;) {
+    struct ex_varid_cache_entry *entry = &file->varid_cache[i];
+    if (entry->exoid == 0) {
+      return -1;
+    }
+    if (entry->exoid == exoid && entry->var_type == (int)var_type &&
+        entry->obj_id_ndx == obj_id_ndx && entry->var_index == var_index) {
+      return entry->varid;
+    }
+    i = (i + 1) & mask;
+  }
+}
+
+static void ex_varid_cache_insert(struct ex_file_item *file, int exoid, int var_type,
+                                  int obj_id_ndx, int var_index, int varid)
+{
+  size_t mask = file->varid_cache_size - 1;
+  size_t i    = ex_varid_cache_hash(exoid, var_type, obj_id_ndx, var_index) & mask;
+  for (;;) {
+    struct ex_varid_cache_entry *entry = &file->varid_cache[i];
+    if (entry->exoid == 0) {
+      entry->exoid      = exoid;
+      entry->var_type   = var_type;
+      entry->obj_id_ndx = obj_id_ndx;
+      entry->var_index  = var_index;
+      entry->varid      = varid;
+      file->varid_cache_count++;
+      return;
+    }
+    if (entry->exoid == exoid && entry->var_type == var_type && entry->obj_id_ndx == obj_id_ndx &&
+        entry->var_index == var_index) {
+      entry->varid = varid;
+      return;
+    }
+    i = (i + 1) & mask;
+  }
+}
+
+void ex_set_cached_varid(int exoid, ex_entity_type var_type, int obj_id_ndx, int var_index,
+                         int varid)
+{
+  struct ex_file_item *file = ex_find_file_item(exoid);
+
+  if (file == NULL || varid < 0) {
+    return;
+  }
+
+  /* Keep load factor at or below 1/2 */
+  if (2 * (file->varid_cache_count + 1) > file->varid_cache_size) {
+    struct ex_varid_cache_entry *old_cache = file->varid_cache;
+    size_t                       old_size  = file->varid_cache_size;
+    size_t                       new_size  = old_size == 0 ? 64 : 2 * old_size;
+    size_t                       i;
+
+    struct ex_varid_cache_entry *new_cache = calloc(new_size, sizeof(struct ex_varid_cache_entry));
+    if (new_cache == NULL) {
+      return; /* Cache is an optimization only */
+    }
+    file->varid_cache       = new_cache;
+    file->varid_cache_size  = new_size;
+    file->varid_cache_count = 0;
+    for (i = 0; i < old_size; i++) {
+      if (old_cache[i].exoid != 0) {
+        ex_varid_cache_insert(file, old_cache[i].exoid, old_cache[i].var_type,
+                              old_cache[i].obj_id_ndx, old_cache[i].var_index,
+                              old_cache[i].varid);
+      }
+    }
+    free(old_cache);
+  }
+  ex_varid_cache_insert(file, exoid, var_type, obj_id_ndx, var_index, varid);
+}
+
+/*
+ * Get the netcdf variable id of the `var_index`-th results variable of
+ * the entity at (1-based) index `obj_id_ndx`; or of the
+ * `var_index`-th nodal variable if `var_type` is EX_NODAL.  Returns the
+ * nc_inq_varid status.
+ */
+int ex_get_varid_of_object(int exoid, ex_entity_type var_type, int var_index, int obj_id_ndx,
+                           int *varid)
+{
+  int status;
+
+  if ((*varid = ex_get_cached_varid(exoid, var_type, obj_id_ndx, var_index)) >= 0) {
+    return NC_NOERR;
+  }
+
+  if (var_type == EX_NODAL) {
+    status = nc_inq_varid(exoid, VAR_NOD_VAR_NEW(var_index), varid);
+  }
+  else {
+    status = nc_inq_varid(exoid, ex_name_var_of_object(var_type, var_index, obj_id_ndx), varid);
+  }
+  if (status == NC_NOERR) {
+    ex_set_cached_varid(exoid, var_type, obj_id_ndx, var_index, *varid);
+  }
+  return status;
+}
+
 void ex_check_valid_file_id(int exoid, const char *func)
 {
   int error = 0;
@@ -116,6 +289,8 @@ int ex_conv_ini(int exoid, int *comp_wordsize, int *io_wordsize, int file_wordsi
   char                 errmsg[MAX_ERR_LENGTH];
   struct ex_file_item *new_file;
   int                  filetype = 0;
+  int                  dimid;
+  int                  hist_steps;
 
   /*! ex_conv_ini() initializes the floating point conversion process.
    *
@@ -235,6 +410,10 @@ int ex_conv_ini(int exoid, int *comp_wordsize, int *io_wordsize, int file_wordsi
   new_file->int64_status          = int64_status;
   new_file->maximum_name_length   = ex_default_max_name_length;
   new_file->time_varid            = -1;
+  new_file->time_hist_steps       = 0;
+  new_file->varid_cache           = NULL;
+  new_file->varid_cache_size      = 0;
+  new_file->varid_cache_count     = 0;
   new_file->compression_level     = 0;
   new_file->shuffle               = 0;
   new_file->file_type             = filetype - 1;
@@ -245,9 +424,31 @@ int ex_conv_ini(int exoid, int *comp_wordsize, int *io_wordsize, int file_wordsi
   new_file->has_edges             = 1;
   new_file->has_faces             = 1;
   new_file->has_elems             = 1;
+  new_file->time_history          = 0;
 
-  new_file->next = file_list;
-  file_list      = new_file;
+  /* Cache the time-history state so that writing results need not look
+   * it up; see ex_invalidate_time_history(). */
+  if (nc_inq_dimid(exoid, DIM_TIME_HIST, &dimid) == NC_NOERR &&
+      nc_get_att_int(exoid, NC_GLOBAL, ATT_TIME_HIST_VALID, &hist_steps) == NC_NOERR) {
+    new_file->time_hist_steps = hist_steps;
+  }
+
+  if (file_count >= file_table_size) {
+    ex_grow_file_table();
+    if (file_table_size == 0) {
+      free(new_file->varid_cache);
+      free(new_file);
+      snprintf(errmsg, MAX_ERR_LENGTH,
+               "ERROR: failed to allocate memory for internal file "
+               "table storage file id %d",
+               exoid);
+      ex_err(__func__, errmsg, EX_MEMFAIL);
+      EX_FUNC_LEAVE(EX_FATAL);
+    }
+  }
+  new_file->next         = *ex_file_bucket(exoid);
+  *ex_file_bucket(exoid) = new_file;
+  file_count++;
 
   if (*io_wordsize == NC_FLOAT_WORDSIZE) {
     new_file->netcdf_type_code = NC_FLOAT;
@@ -262,8 +463,8 @@ int ex_conv_ini(int exoid, int *comp_wordsize, int *io_wordsize, int file_wordsi
 /*............................................................................*/
 /*............................................................................*/
 
-/*! ex_conv_exit() takes the structure identified by "exoid" out of the linked
- * list which describes the files that ex_conv_array() knows how to convert.
+/*! ex_conv_exit() takes the structure identified by "exoid" out of the hash
+ * table which describes the files that ex_conv_array() knows how to convert.
  *
  * \note it is absolutely necessary for ex_conv_exit() to be called after
  *       ncclose(), if the parameter used as "exoid" is the id returned from
@@ -276,17 +477,19 @@ void ex_conv_exit(int exoid)
 {
 
   char                 errmsg[MAX_ERR_LENGTH];
-  struct ex_file_item *file = file_list;
-  struct ex_file_item *prev = NULL;
+  struct ex_file_item **link = NULL;
+  struct ex_file_item * file = NULL;
 
   EX_FUNC_ENTER();
-  while (file) {
-    if (file->file_id == exoid) {
-      break;
+  if (file_table_size > 0) {
+    link = ex_file_bucket(exoid);
+    while (*link) {
+      if ((*link)->file_id == exoid) {
+        file = *link;
+        break;
+      }
+      link = &(*link)->next;
     }
-
-    prev = file;
-    file = file->next;
   }
 
   if (!file) {
@@ -295,13 +498,10 @@ void ex_conv_exit(int exoid)
     EX_FUNC_VOID();
   }
 
-  if (prev) {
-    prev->next = file->next;
-  }
-  else {
-    file_list = file->next;
-  }
+  *link = file->next;
+  file_count--;
 
+  free(file->varid_cache);
   free(file);
   EX_FUNC_VOID();
 }
@@ -433,6 +633,9 @@ int ex_set_option(int exoid, ex_option_type option, int option_value)
     ex_set_int64_status(exoid, option_value);
     break;
   case EX_OPT_INTEGER_SIZE_DB: /* (query only) */ break;
+  case EX_OPT_TIME_HISTORY: /* 0 (disabled); 1 (write ex_put_time_history() at close) */
+    file->time_history = option_value != 0 ? 1 : 0;
+    break;
   default: {
     char errmsg[MAX_ERR_LENGTH];
     snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: invalid option %d for ex_set_option().", (int)option);
@@ -105,8 +105,9 @@ int ex_get_glob_var_time_int(int exoid, int glob_var_index, int beg_time_step, i
                              void *glob_var_vals)
 {
   int    status;
-  int    varid;
+  int    varid, hist_varid;
   size_t start[2], count[2];
+  size_t hist_steps;
   char   errmsg[MAX_ERR_LENGTH];
 
   EX_FUNC_ENTER();
@@ -157,6 +158,16 @@ int ex_get_glob_var_time_int(int exoid, int glob_var_index, int beg_time_step, i
     EX_FUNC_LEAVE(EX_WARN);
   }
 
+  /* use the time-major copy if it covers the requested steps */
+  if (ex_get_time_history_varid(exoid, varid, &hist_varid, &hist_steps) == NC_NOERR &&
+      (size_t)end_time_step < hist_steps) {
+    varid    = hist_varid;
+    start[0] = glob_var_index;
+    start[1] = beg_time_step;
+    count[0] = 1;
+    count[1] = end_time_step - beg_time_step + 1;
+  }
+
   if (ex_comp_ws(exoid) == 4) {
     status = nc_get_vara_float(exoid, varid, start, count, glob_var_vals);
   }
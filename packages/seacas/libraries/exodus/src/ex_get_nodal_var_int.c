@@ -149,7 +149,8 @@ int ex_get_nodal_var_int(int exoid, int time_step, int nodal_var_index, int64_t
   else {
     /* read values of the nodal variable  -- stored as separate variables... */
     /* Get the varid.... */
-    if ((status = nc_inq_varid(exoid, VAR_NOD_VAR_NEW(nodal_var_index), &varid)) != NC_NOERR) {
+    if ((status = ex_get_varid_of_object(exoid, EX_NODAL, nodal_var_index, 0, &varid)) !=
+        NC_NOERR) {
       snprintf(errmsg, MAX_ERR_LENGTH, "Warning: could not find nodal variable %d in file id %d",
                nodal_var_index, exoid);
       ex_err(__func__, errmsg, status);
@@ -114,8 +114,9 @@ int ex_get_nodal_var_time_int(int exoid, int nodal_var_index, int64_t node_numbe
                               int beg_time_step, int end_time_step, void *nodal_var_vals)
 {
   int    status;
-  int    varid;
+  int    varid, hist_varid;
   size_t start[3], count[3];
+  size_t hist_steps;
   char   errmsg[MAX_ERR_LENGTH];
 
   EX_FUNC_ENTER();
@@ -174,7 +175,8 @@ int ex_get_nodal_var_time_int(int exoid, int nodal_var_index, int64_t node_numbe
     count[2] = 1;
   }
   else {
-    if ((status = nc_inq_varid(exoid, VAR_NOD_VAR_NEW(nodal_var_index), &varid)) != NC_NOERR) {
+    if ((status = ex_get_varid_of_object(exoid, EX_NODAL, nodal_var_index, 0, &varid)) !=
+        NC_NOERR) {
       snprintf(errmsg, MAX_ERR_LENGTH, "Warning: could not find nodal variable %d in file id %d",
                nodal_var_index, exoid);
       ex_err(__func__, errmsg, status);
@@ -191,6 +193,16 @@ int ex_get_nodal_var_time_int(int exoid, int nodal_var_index, int64_t node_numbe
 
     count[0] = end_time_step - beg_time_step + 1;
     count[1] = 1;
+
+    /* use the time-major copy if it covers the requested steps */
+    if (ex_get_time_history_varid(exoid, varid, &hist_varid, &hist_steps) == NC_NOERR &&
+        (size_t)end_time_step < hist_steps) {
+      varid    = hist_varid;
+      start[0] = node_number;
+      start[1] = beg_time_step;
+      count[0] = 1;
+      count[1] = end_time_step - beg_time_step + 1;
+    }
   }
 
   if (ex_comp_ws(exoid) == 4) {
@@ -76,11 +76,12 @@
 int ex_get_var_time(int exoid, ex_entity_type var_type, int var_index, int64_t id,
                     int beg_time_step, int end_time_step, void *var_vals)
 {
-  int         dimid, varid, numel = 0, offset;
+  int         dimid, varid, hist_varid, numel = 0, offset;
   int         status;
   int *       stat_vals = NULL;
   size_t      num_obj, i;
   size_t      num_entries_this_obj = 0;
+  size_t      hist_steps;
   size_t      start[2], count[2];
   char        errmsg[MAX_ERR_LENGTH];
   const char *varobjids;
@@ -247,7 +248,7 @@ int ex_get_var_time(int exoid, ex_entity_type var_type, int var_index, int64_t i
   offset = id - (numel - num_entries_this_obj);
 
   /* inquire previously defined variable */
-  if ((status = nc_inq_varid(exoid, ex_name_var_of_object(var_type, var_index, i + 1), &varid)) !=
+  if ((status = ex_get_varid_of_object(exoid, var_type, var_index, i + 1, &varid)) !=
       NC_NOERR) {
     snprintf(errmsg, MAX_ERR_LENGTH,
              "ERROR: failed to locate variable %" ST_ZU " for %dth %s in file id %d", i, var_index,
@@ -297,6 +298,16 @@ int ex_get_var_time(int exoid, ex_entity_type var_type, int var_index, int64_t i
   count[0] = end_time_step - beg_time_step + 1;
   count[1] = 1;
 
+  /* use the time-major copy if it covers the requested steps */
+  if (ex_get_time_history_varid(exoid, varid, &hist_varid, &hist_steps) == NC_NOERR &&
+      (size_t)end_time_step < hist_steps) {
+    varid    = hist_varid;
+    start[0] = offset;
+    start[1] = beg_time_step;
+    count[0] = 1;
+    count[1] = end_time_step - beg_time_step + 1;
+  }
+
   if (ex_comp_ws(exoid) == 4) {
     status = nc_get_vara_float(exoid, varid, start, count, var_vals);
   }
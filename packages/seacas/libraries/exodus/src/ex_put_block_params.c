@@ -171,7 +171,11 @@ int ex_put_block_params(int exoid, size_t block_count, const struct ex_block *bl
     /*   NOTE: ex_inc_file_item  is a function that finds the number of element
          blocks for a specific file and returns that value incremented. */
     cur_num_blk = ex_inc_file_item(exoid, ex_get_counter_list(blocks[i].type));
-    start[0]    = cur_num_blk;
+    if (cur_num_blk < 0) {
+      free(blocks_to_define);
+      EX_FUNC_LEAVE(EX_FATAL); /* error reported by ex_inc_file_item */
+    }
+    start[0] = cur_num_blk;
 
     /* write out block id to previously defined id array variable*/
     status = nc_put_var1_longlong(exoid, varid, start, (long long *)&blocks[i].id);
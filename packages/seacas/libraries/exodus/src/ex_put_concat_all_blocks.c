@@ -366,6 +366,9 @@ int ex_put_concat_all_blocks(int exoid, const ex_block_params *param)
     /* NOTE: ex_inc_file_item  is used to find the number of edge blocks
        for a specific file and returns that value incremented. */
     cur_num_edge_blk = ex_inc_file_item(exoid, ex_get_counter_list(EX_EDGE_BLOCK));
+    if (cur_num_edge_blk < 0) {
+      goto error_ret; /* error reported by ex_inc_file_item */
+    }
 
     if (param->num_edge_this_blk[iblk] == 0) { /* Is this a NULL edge block? */
       continue;
@@ -434,6 +437,9 @@ int ex_put_concat_all_blocks(int exoid, const ex_block_params *param)
     /* NOTE: ex_inc_file_item  is used to find the number of edge blocks
        for a specific file and returns that value incremented. */
     cur_num_face_blk = ex_inc_file_item(exoid, ex_get_counter_list(EX_FACE_BLOCK));
+    if (cur_num_face_blk < 0) {
+      goto error_ret; /* error reported by ex_inc_file_item */
+    }
 
     if (param->num_face_this_blk[iblk] == 0) { /* Is this a NULL face block? */
       continue;
@@ -503,6 +509,9 @@ int ex_put_concat_all_blocks(int exoid, const ex_block_params *param)
     /* NOTE: ex_inc_file_item  is used to find the number of element blocks
        for a specific file and returns that value incremented. */
     cur_num_elem_blk = ex_inc_file_item(exoid, ex_get_counter_list(EX_ELEM_BLOCK));
+    if (cur_num_elem_blk < 0) {
+      goto error_ret; /* error reported by ex_inc_file_item */
+    }
 
     if (param->num_elem_this_blk[iblk] == 0) { /* Is this a NULL element block? */
       continue;
@@ -226,6 +226,9 @@ int ex_put_concat_elem_block(int exoid, const void_int *elem_blk_id, char *elem_
     /* NOTE: ex_inc_file_item  is used to find the number of element blocks
        for a specific file and returns that value incremented. */
     cur_num_elem_blk = ex_inc_file_item(exoid, ex_get_counter_list(EX_ELEM_BLOCK));
+    if (cur_num_elem_blk < 0) {
+      goto error_ret; /* error reported by ex_inc_file_item */
+    }
 
     if (eb_array[iblk] == 0) { /* Is this a NULL element block? */
       continue;
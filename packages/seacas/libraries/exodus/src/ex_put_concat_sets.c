@@ -236,7 +236,10 @@ int ex_put_concat_sets(int exoid, ex_entity_type set_type, const struct ex_set_s
          for a specific file and returns that value incremented. */
 
     cur_num_sets = ex_inc_file_item(exoid, ex_get_counter_list(set_type));
-    set_id_ndx   = cur_num_sets + 1;
+    if (cur_num_sets < 0) {
+      goto error_ret; /* error reported by ex_inc_file_item */
+    }
+    set_id_ndx = cur_num_sets + 1;
 
     /* setup more pointers based on set_type */
     if (set_type == EX_NODE_SET) {
@@ -110,7 +110,7 @@ int ex_put_nodal_var_int(int exoid, int time_step, int nodal_var_index, int64_t
   size_t start[3], count[3];
   char   errmsg[MAX_ERR_LENGTH];
 
-  if ((status = nc_inq_varid(exoid, VAR_NOD_VAR_NEW(nodal_var_index), &varid)) != NC_NOERR) {
+  if ((status = ex_get_varid_of_object(exoid, EX_NODAL, nodal_var_index, 0, &varid)) != NC_NOERR) {
     snprintf(errmsg, MAX_ERR_LENGTH, "Warning: could not find nodal variable %d in file id %d",
              nodal_var_index, exoid);
     ex_err(__func__, errmsg, status);
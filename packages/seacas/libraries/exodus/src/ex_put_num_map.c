@@ -160,6 +160,9 @@ int ex_put_num_map(int exoid, ex_entity_type map_type, ex_entity_id map_id, cons
   /*   NOTE: ex_inc_file_item  is used to find the number of maps
        for a specific file and returns that value incremented. */
   cur_num_maps = ex_inc_file_item(exoid, ex_get_counter_list(map_type));
+  if (cur_num_maps < 0) {
+    EX_FUNC_LEAVE(EX_FATAL); /* error reported by ex_inc_file_item */
+  }
 
   /* write out information to previously defined variable */
 
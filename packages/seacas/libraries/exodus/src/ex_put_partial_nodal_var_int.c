@@ -85,7 +85,7 @@ int ex_put_partial_nodal_var_int(int exoid, int time_step, int nodal_var_index,
   EX_FUNC_ENTER();
   ex_check_valid_file_id(exoid, __func__);
 
-  if ((status = nc_inq_varid(exoid, VAR_NOD_VAR_NEW(nodal_var_index), &varid)) != NC_NOERR) {
+  if ((status = ex_get_varid_of_object(exoid, EX_NODAL, nodal_var_index, 0, &varid)) != NC_NOERR) {
     snprintf(errmsg, MAX_ERR_LENGTH, "Warning: could not find nodal variable %d in file id %d",
              nodal_var_index, exoid);
     ex_err(__func__, errmsg, status);
@@ -157,6 +157,9 @@ int ex_put_partial_num_map(int exoid, ex_entity_type map_type, ex_entity_id map_
     /*   NOTE: ex_inc_file_item  is used to find the number of element maps
          for a specific file and returns that value incremented. */
     cur_num_maps = ex_inc_file_item(exoid, ex_get_counter_list(map_type));
+    if (cur_num_maps < 0) {
+      EX_FUNC_LEAVE(EX_FATAL); /* error reported by ex_inc_file_item */
+    }
   }
   else {
     map_ndx      = ex_id_lkup(exoid, map_type, map_id);
@@ -89,6 +89,9 @@ int ex_put_partial_var(int exoid, int time_step, ex_entity_type var_type, int va
   }
 #endif
 
+  /* Values of a step already in the time-history copy are being replaced */
+  ex_invalidate_time_history(exoid, time_step);
+
 #define EX_LOOK_UP_VAR(VOBJID, VVAR, VOBJTAB, DNUMOBJ, DNUMOBJVAR)                                 \
   /* Determine index of obj_id in VOBJID array */                                                  \
   obj_id_ndx = ex_id_lkup(exoid, var_type, obj_id);                                                \
@@ -113,7 +116,8 @@ int ex_put_partial_var(int exoid, int time_step, ex_entity_type var_type, int va
     }                                                                                              \
   }                                                                                                \
                                                                                                    \
-  if ((status = nc_inq_varid(exoid, VVAR(var_index, obj_id_ndx), &varid)) != NC_NOERR) {           \
+  if ((status = ex_get_varid_of_object(exoid, var_type, var_index, obj_id_ndx, &varid)) !=         \
+      NC_NOERR) {                                                                                  \
     if (status == NC_ENOTVAR) /* variable doesn't exist, create it! */                             \
     {                                                                                              \
       /* check for the existence of an TNAME variable truth table */                               \
@@ -187,6 +191,7 @@ int ex_put_partial_var(int exoid, int time_step, ex_entity_type var_type, int va
         goto error_ret;                                                                            \
       }                                                                                            \
       ex_compress_variable(exoid, varid, 2);                                                       \
+      ex_set_cached_varid(exoid, var_type, obj_id_ndx, var_index, varid);                          \
                                                                                                    \
       /*    leave define mode  */                                                                  \
                                                                                                    \
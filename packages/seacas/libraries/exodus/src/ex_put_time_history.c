@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2005-2017 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above
+ *       copyright notice, this list of conditions and the following
+ *       disclaimer in the documentation and/or other materials provided
+ *       with the distribution.
+ *
+ *     * Neither the name of NTESS nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "exodusII.h"     // for ex_err, etc
+#include "exodusII_int.h" // for EX_FATAL, etc
+#include "netcdf.h"       // for NC_NOERR, nc_inq_varid, etc
+#include <stddef.h>       // for size_t
+#include <stdio.h>
+#include <stdlib.h> // for free, malloc
+#include <string.h> // for strlen, strcmp, strncmp
+
+/* Number of values transposed per pass; scratch memory is two
+ * buffers of this many doubles. */
+#define EX_TIME_HIST_BUFFER (4 * 1024 * 1024)
+
+/* Returns the entity dimension if `varid` is a results variable
+ * dimensioned (time_step, num_entity), otherwise -1. */
+static int ex_time_history_source(int exoid, int varid, int time_dim)
+{
+  char   name[NC_MAX_NAME + 1];
+  int    ndims;
+  int    dims[NC_MAX_VAR_DIMS];
+  size_t name_len;
+  size_t suffix_len = strlen(VAR_HIST_SUFFIX);
+
+  if (nc_inq_var(exoid, varid, name, NULL, &ndims, dims, NULL) != NC_NOERR) {
+    return -1;
+  }
+  if (ndims != 2 || dims[0] != time_dim || strncmp(name, "vals_", 5) != 0) {
+    return -1;
+  }
+  name_len = strlen(name);
+  if (name_len > suffix_len && strcmp(name + name_len - suffix_len, VAR_HIST_SUFFIX) == 0) {
+    return -1;
+  }
+  return dims[1];
+}
+
+/* Copy `src_varid` (time_step, num_entity) into `hist_varid`
+ * (num_entity, time_history_step), a block of entities at a time. */
+static int ex_transpose_time_history(int exoid, int src_varid, int hist_varid, int entity_dim,
+                                     size_t num_steps, double *in, double *out)
+{
+  size_t num_entity;
+  size_t block = EX_TIME_HIST_BUFFER / num_steps;
+  size_t beg, i, j;
+  int    status;
+
+  if ((status = nc_inq_dimlen(exoid, entity_dim, &num_entity)) != NC_NOERR) {
+    return status;
+  }
+  if (block == 0) {
+    block = 1;
+  }
+
+  for (beg = 0; beg < num_entity; beg += block) {
+    size_t count[2], start[2];
+    size_t num = num_entity - beg < block ? num_entity - beg : block;
+
+    start[0] = 0;
+    start[1] = beg;
+    count[0] = num_steps;
+    count[1] = num;
+    if ((status = nc_get_vara_double(exoid, src_varid, start, count, in)) != NC_NOERR) {
+      return status;
+    }
+
+    for (i = 0; i < num_steps; i++) {
+      for (j = 0; j < num; j++) {
+        out[j * num_steps + i] = in[i * num + j];
+      }
+    }
+
+    start[0] = beg;
+    start[1] = 0;
+    count[0] = num;
+    count[1] = num_steps;
+    if ((status = nc_put_vara_double(exoid, hist_varid, start, count, out)) != NC_NOERR) {
+      return status;
+    }
+  }
+  return NC_NOERR;
+}
+
+/*!
+\ingroup ResultsData
+
+ * writes a time-major copy of every results variable (global, nodal,
+ * and block or set variables) currently on the database.  The values
+ * of a variable are stored one time step after another, so reading a
+ * single entity through time with ex_get_var_time() is one contiguous
+ * read instead of one small read per time step.  ex_get_var_time()
+ * uses the copy automatically for any request which ends at or before
+ * the last step that was present when the copy was written; later
+ * steps are read from the normal per-step layout.  If the values of a
+ * step already in the copy are rewritten, the copy is only used for
+ * the steps before it.
+ *
+ * The copy roughly doubles the size of the results data and can only
+ * be written once per file.  It can be requested at ex_close() time via
+ * ex_set_option(exoid, EX_OPT_TIME_HISTORY, 1).  Nodal variables stored
+ * in the obsolete single-array (non large-model) format are not copied.
+ *
+ * \param      exoid                   exodus file id
+ *
+ * Returns EX_WARN if the database already has a time-history copy.
+ */
+
+int ex_put_time_history(int exoid)
+{
+  int     status;
+  int     time_dim, hist_dim;
+  int     num_vars, varid;
+  int     num_hist = 0;
+  int     num_steps;
+  int *   src_varids  = NULL;
+  int *   hist_varids = NULL;
+  int *   entity_dims = NULL;
+  double *in          = NULL;
+  double *out         = NULL;
+  char    errmsg[MAX_ERR_LENGTH];
+
+  struct ex_file_item *file;
+
+  EX_FUNC_ENTER();
+  ex_check_valid_file_id(exoid, __func__);
+
+  num_steps = ex_inquire_int(exoid, EX_INQ_TIME);
+  if (num_steps <= 0) {
+    EX_FUNC_LEAVE(EX_NOERR);
+  }
+
+  if (nc_inq_dimid(exoid, DIM_TIME_HIST, &hist_dim) == NC_NOERR) {
+    snprintf(errmsg, MAX_ERR_LENGTH, "Warning: time history already written to file id %d",
+             exoid);
+    ex_err(__func__, errmsg, EX_MSG);
+    EX_FUNC_LEAVE(EX_WARN);
+  }
+
+  if ((status = nc_inq_dimid(exoid, DIM_TIME, &time_dim)) != NC_NOERR) {
+    snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: failed to locate time dimension in file id %d",
+             exoid);
+    ex_err(__func__, errmsg, status);
+    EX_FUNC_LEAVE(EX_FATAL);
+  }
+
+  if ((status = nc_inq(exoid, NULL, &num_vars, NULL, NULL)) != NC_NOERR) {
+    snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: failed to get number of variables in file id %d",
+             exoid);
+    ex_err(__func__, errmsg, status);
+    EX_FUNC_LEAVE(EX_FATAL);
+  }
+
+  src_varids  = malloc(num_vars * sizeof(int));
+  hist_varids = malloc(num_vars * sizeof(int));
+  entity_dims = malloc(num_vars * sizeof(int));
+  if (src_varids == NULL || hist_varids == NULL || entity_dims == NULL) {
+    snprintf(errmsg, MAX_ERR_LENGTH,
+             "ERROR: failed to allocate memory for time history of file id %d", exoid);
+    ex_err(__func__, errmsg, EX_MEMFAIL);
+    goto error_ret;
+  }
+
+  /* put the file into define mode and define the copies */
+  if ((status = nc_redef(exoid)) != NC_NOERR) {
+    snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: failed to put file id %d into define mode", exoid);
+    ex_err(__func__, errmsg, status);
+    goto error_ret;
+  }
+
+  if ((status = nc_def_dim(exoid, DIM_TIME_HIST, num_steps, &hist_dim)) != NC_NOERR) {
+    snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: failed to define time history dimension in file id %d",
+             exoid);
+    ex_err(__func__, errmsg, status);
+    ex_leavedef(exoid, __func__);
+    goto error_ret;
+  }
+
+  /* Lowered by ex_invalidate_time_history() if a step is rewritten. */
+  if ((status = nc_put_att_int(exoid, NC_GLOBAL, ATT_TIME_HIST_VALID, NC_INT, 1, &num_steps)) !=
+      NC_NOERR) {
+    snprintf(errmsg, MAX_ERR_LENGTH,
+             "ERROR: failed to define time history valid steps in file id %d", exoid);
+    ex_err(__func__, errmsg, status);
+    ex_leavedef(exoid, __func__);
+    goto error_ret;
+  }
+  if ((file = ex_find_file_item(exoid)) != NULL) {
+    file->time_hist_steps = num_steps;
+  }
+
+  for (varid = 0; varid < num_vars; varid++) {
+    char    name[NC_MAX_NAME + 1];
+    nc_type type;
+    int     dims[2];
+    int     entity_dim = ex_time_history_source(exoid, varid, time_dim);
+    if (entity_dim < 0) {
+      continue;
+    }
+
+    nc_inq_varname(exoid, varid, name);
+    if (strlen(name) + strlen(VAR_HIST_SUFFIX) > NC_MAX_NAME) {
+      continue; /* ex_get_time_history_varid() will use the per-step layout */
+    }
+    strcat(name, VAR_HIST_SUFFIX);
+    nc_inq_vartype(exoid, varid, &type);
+
+    dims[0] = entity_dim;
+    dims[1] = hist_dim;
+    if ((status = nc_def_var(exoid, name, type, 2, dims, &hist_varids[num_hist])) != NC_NOERR) {
+      snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: failed to define variable %s in file id %d", name,
+               exoid);
+      ex_err(__func__, errmsg, status);
+      ex_leavedef(exoid, __func__);
+      goto error_ret;
+    }
+    src_varids[num_hist]  = varid;
+    entity_dims[num_hist] = entity_dim;
+    num_hist++;
+  }
+
+  if (ex_leavedef(exoid, __func__) != EX_NOERR) {
+    goto error_ret;
+  }
+
+  {
+    size_t buffer = EX_TIME_HIST_BUFFER > (size_t)num_steps ? EX_TIME_HIST_BUFFER : num_steps;
+    in            = malloc(buffer * sizeof(double));
+    out           = malloc(buffer * sizeof(double));
+    if (in == NULL || out == NULL) {
+      snprintf(errmsg, MAX_ERR_LENGTH,
+               "ERROR: failed to allocate memory for time history of file id %d", exoid);
+      ex_err(__func__, errmsg, EX_MEMFAIL);
+      goto error_ret;
+    }
+  }
+
+  for (varid = 0; varid < num_hist; varid++) {
+    if ((status = ex_transpose_time_history(exoid, src_varids[varid], hist_varids[varid],
+                                            entity_dims[varid], num_steps, in, out)) !=
+        NC_NOERR) {
+      snprintf(errmsg, MAX_ERR_LENGTH,
+               "ERROR: failed to write time history of variable %d in file id %d",
+               src_varids[varid], exoid);
+      ex_err(__func__, errmsg, status);
+      goto error_ret;
+    }
+  }
+
+  free(in);
+  free(out);
+  free(src_varids);
+  free(hist_varids);
+  free(entity_dims);
+  EX_FUNC_LEAVE(EX_NOERR);
+
+error_ret:
+  free(in);
+  free(out);
+  free(src_varids);
+  free(hist_varids);
+  free(entity_dims);
+  EX_FUNC_LEAVE(EX_FATAL);
+}
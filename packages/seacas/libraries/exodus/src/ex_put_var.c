@@ -79,8 +79,8 @@ static int ex_look_up_var(int exoid, ex_entity_type var_type, int var_index, ex_
     }
   }
 
-  if ((status = nc_inq_varid(exoid, ex_name_var_of_object(var_type, var_index, obj_id_ndx),
-                             varid)) != NC_NOERR) {
+  if ((status = ex_get_varid_of_object(exoid, var_type, var_index, obj_id_ndx, varid)) !=
+      NC_NOERR) {
     if (status == NC_ENOTVAR) { /* variable doesn't exist, create it! */
       /* check for the existence of an TNAME variable truth table */
       if (nc_inq_varid(exoid, VOBJTAB, varid) == NC_NOERR) {
@@ -153,6 +153,7 @@ static int ex_look_up_var(int exoid, ex_entity_type var_type, int var_index, ex_
         goto error_ret;
       }
       ex_compress_variable(exoid, *varid, 2);
+      ex_set_cached_varid(exoid, var_type, obj_id_ndx, var_index, *varid);
 
       /*    leave define mode  */
       if ((status = nc_enddef(exoid)) != NC_NOERR) {
@@ -183,6 +184,49 @@ error_ret:
   return (EX_FATAL);
 }
 
+/*
+ * Internal: get the netcdf variable id of the `var_index`-th variable
+ * of the `var_type` entity `obj_id`, defining the variable if it does
+ * not yet exist.  Used by ex_put_var() and ex_put_vars().
+ */
+int ex_look_up_var_id(int exoid, ex_entity_type var_type, int var_index, ex_entity_id obj_id,
+                      int *varid)
+{
+  char errmsg[MAX_ERR_LENGTH];
+
+  switch (var_type) {
+  case EX_EDGE_BLOCK:
+    return ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_ED_BLK, VAR_EBLK_TAB,
+                          DIM_NUM_ED_BLK, DIM_NUM_EDG_VAR, varid);
+  case EX_FACE_BLOCK:
+    return ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_FA_BLK, VAR_FBLK_TAB,
+                          DIM_NUM_FA_BLK, DIM_NUM_FAC_VAR, varid);
+  case EX_ELEM_BLOCK:
+    return ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_EL_BLK, VAR_ELEM_TAB,
+                          DIM_NUM_EL_BLK, DIM_NUM_ELE_VAR, varid);
+  case EX_NODE_SET:
+    return ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_NS_IDS, VAR_NSET_TAB,
+                          DIM_NUM_NS, DIM_NUM_NSET_VAR, varid);
+  case EX_EDGE_SET:
+    return ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_ES_IDS, VAR_ESET_TAB,
+                          DIM_NUM_ES, DIM_NUM_ESET_VAR, varid);
+  case EX_FACE_SET:
+    return ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_FS_IDS, VAR_FSET_TAB,
+                          DIM_NUM_FS, DIM_NUM_FSET_VAR, varid);
+  case EX_SIDE_SET:
+    return ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_SS_IDS, VAR_SSET_TAB,
+                          DIM_NUM_SS, DIM_NUM_SSET_VAR, varid);
+  case EX_ELEM_SET:
+    return ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_ELS_IDS, VAR_ELSET_TAB,
+                          DIM_NUM_ELS, DIM_NUM_ELSET_VAR, varid);
+  default:
+    snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: invalid variable type (%d) specified for file id %d",
+             var_type, exoid);
+    ex_err(__func__, errmsg, EX_BADPARAM);
+    return (EX_FATAL);
+  }
+}
+
 /*
 \ingroup ResultsData
 
@@ -226,6 +270,9 @@ int ex_put_var(int exoid, int time_step, ex_entity_type var_type, int var_index,
   }
 #endif
 
+  /* Values of a step already in the time-history copy are being replaced */
+  ex_invalidate_time_history(exoid, time_step);
+
   switch (var_type) {
   case EX_GLOBAL:
     if (num_entries_this_obj <= 0) {
@@ -254,43 +301,9 @@ int ex_put_var(int exoid, int time_step, ex_entity_type var_type, int var_index,
     status = ex_put_nodal_var_int(exoid, time_step, var_index, num_entries_this_obj, var_vals);
     EX_FUNC_LEAVE(status);
     break;
-  case EX_EDGE_BLOCK:
-    status = ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_ED_BLK, VAR_EBLK_TAB,
-                            DIM_NUM_ED_BLK, DIM_NUM_EDG_VAR, &varid);
-    break;
-  case EX_FACE_BLOCK:
-    status = ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_FA_BLK, VAR_FBLK_TAB,
-                            DIM_NUM_FA_BLK, DIM_NUM_FAC_VAR, &varid);
-    break;
-  case EX_ELEM_BLOCK:
-    status = ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_EL_BLK, VAR_ELEM_TAB,
-                            DIM_NUM_EL_BLK, DIM_NUM_ELE_VAR, &varid);
-    break;
-  case EX_NODE_SET:
-    status = ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_NS_IDS, VAR_NSET_TAB,
-                            DIM_NUM_NS, DIM_NUM_NSET_VAR, &varid);
-    break;
-  case EX_EDGE_SET:
-    status = ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_ES_IDS, VAR_ESET_TAB,
-                            DIM_NUM_ES, DIM_NUM_ESET_VAR, &varid);
-    break;
-  case EX_FACE_SET:
-    status = ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_FS_IDS, VAR_FSET_TAB,
-                            DIM_NUM_FS, DIM_NUM_FSET_VAR, &varid);
-    break;
-  case EX_SIDE_SET:
-    status = ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_SS_IDS, VAR_SSET_TAB,
-                            DIM_NUM_SS, DIM_NUM_SSET_VAR, &varid);
-    break;
-  case EX_ELEM_SET:
-    status = ex_look_up_var(exoid, var_type, var_index, obj_id, VAR_ELS_IDS, VAR_ELSET_TAB,
-                            DIM_NUM_ELS, DIM_NUM_ELSET_VAR, &varid);
-    break;
   default:
-    snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: invalid variable type (%d) specified for file id %d",
-             var_type, exoid);
-    ex_err(__func__, errmsg, EX_BADPARAM);
-    EX_FUNC_LEAVE(EX_FATAL);
+    status = ex_look_up_var_id(exoid, var_type, var_index, obj_id, &varid);
+    break;
   }
 
   if (status != EX_NOERR) {
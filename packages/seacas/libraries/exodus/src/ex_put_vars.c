@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2005-2017 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above
+ *       copyright notice, this list of conditions and the following
+ *       disclaimer in the documentation and/or other materials provided
+ *       with the distribution.
+ *
+ *     * Neither the name of NTESS nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "exodusII.h"     // for ex_err, etc
+#include "exodusII_int.h" // for EX_FATAL, etc
+#include "netcdf.h"       // for NC_NOERR, nc_inq_varid, etc
+#include <inttypes.h>     // for PRId64
+#include <stddef.h>       // for size_t
+#include <stdio.h>
+#include <sys/types.h> // for int64_t
+
+/*!
+\ingroup ResultsData
+
+ * writes the values of several variables of a single entity type at
+ * one time step to the database.  Equivalent to calling
+ * ex_put_partial_var() (or ex_put_var()) once for each entry in `vars`,
+ * but the time step, word size, and file id are validated only once,
+ * the netcdf variable id is reused for consecutive entries referring
+ * to the same variable, and consecutive entries which continue the
+ * same variable both on the file and in memory are written with a
+ * single hyperslab write.
+ *
+ * \param      exoid                   exodus file id
+ * \param      time_step               time step number (1-based)
+ * \param      var_type                type (nodal, element block, node set,
+ * ... ); global variables are not supported
+ * \param      var_count               number of entries in `vars`
+ * \param      vars                    array of ex_var_data structures
+ * describing the values to be written.  `id` is ignored for nodal variables,
+ * `start_index` is the 1-based index of the first entry in the entity to
+ * write.
+ *
+ * Returns EX_WARN if any entry referred to a NULL entity or an
+ * undefined nodal variable; those entries are skipped.
+ */
+
+int ex_put_vars(int exoid, int time_step, ex_entity_type var_type, size_t var_count,
+                const struct ex_var_data *vars)
+{
+  int     varid = -1;
+  int     prev_index = 0;
+  int64_t prev_id    = 0;
+  int     ws;
+  int     status;
+  int     warning = 0;
+  size_t  i, j;
+  size_t  start[2], count[2];
+  char    errmsg[MAX_ERR_LENGTH];
+
+  EX_FUNC_ENTER();
+
+  ex_check_valid_file_id(exoid, __func__);
+
+  if (var_type == EX_GLOBAL) {
+    snprintf(errmsg, MAX_ERR_LENGTH,
+             "ERROR: global variables must be written with ex_put_var in file id %d", exoid);
+    ex_err(__func__, errmsg, EX_BADPARAM);
+    EX_FUNC_LEAVE(EX_FATAL);
+  }
+
+#if !defined EXODUS_IN_SIERRA
+  /* Verify that time_step is within bounds */
+  {
+    int num_time_steps = ex_inquire_int(exoid, EX_INQ_TIME);
+    if (time_step <= 0 || time_step > num_time_steps) {
+      snprintf(errmsg, MAX_ERR_LENGTH,
+               "ERROR: time_step is out-of-range. Value = %d, valid "
+               "range is 1 to %d in file id %d",
+               time_step, num_time_steps, exoid);
+      ex_err(__func__, errmsg, EX_BADPARAM);
+      EX_FUNC_LEAVE(EX_FATAL);
+    }
+  }
+#endif
+
+  /* Values of a step already in the time-history copy are being replaced */
+  ex_invalidate_time_history(exoid, time_step);
+
+  ws = ex_comp_ws(exoid);
+
+  for (i = 0; i < var_count; i = j) {
+    const struct ex_var_data *var       = &vars[i];
+    int64_t                   num_entry = var->num_entry;
+
+    /* Coalesce following entries which continue this variable on the
+     * file and whose values immediately follow in memory. */
+    for (j = i + 1; j < var_count; j++) {
+      const struct ex_var_data *next = &vars[j];
+      if (next->var_index != var->var_index || (var_type != EX_NODAL && next->id != var->id) ||
+          next->start_index != var->start_index + num_entry ||
+          (const char *)next->values != (const char *)var->values + num_entry * ws) {
+        break;
+      }
+      num_entry += next->num_entry;
+    }
+
+    if (varid < 0 || var->var_index != prev_index ||
+        (var_type != EX_NODAL && var->id != prev_id)) {
+      if (var_type == EX_NODAL) {
+        if ((status = ex_get_varid_of_object(exoid, EX_NODAL, var->var_index, 0, &varid)) !=
+            NC_NOERR) {
+          snprintf(errmsg, MAX_ERR_LENGTH,
+                   "Warning: could not find nodal variable %d in file id %d", var->var_index,
+                   exoid);
+          ex_err(__func__, errmsg, status);
+          status = EX_WARN;
+        }
+      }
+      else {
+        status = ex_look_up_var_id(exoid, var_type, var->var_index, var->id, &varid);
+      }
+
+      if (status == EX_WARN) {
+        warning = 1;
+        varid   = -1;
+        continue;
+      }
+      if (status != EX_NOERR) {
+        EX_FUNC_LEAVE(status);
+      }
+      prev_index = var->var_index;
+      prev_id    = var->id;
+    }
+
+    start[0] = time_step - 1;
+    start[1] = num_entry == 0 ? 0 : var->start_index - 1;
+
+    count[0] = 1;
+    count[1] = num_entry;
+
+    if (ws == 4) {
+      status = nc_put_vara_float(exoid, varid, start, count, var->values);
+    }
+    else {
+      status = nc_put_vara_double(exoid, varid, start, count, var->values);
+    }
+
+    if (status != NC_NOERR) {
+      snprintf(errmsg, MAX_ERR_LENGTH,
+               "ERROR: failed to store %s %" PRId64 " variable %d in file id %d",
+               ex_name_of_object(var_type), var->id, var->var_index, exoid);
+      ex_err(__func__, errmsg, status);
+      EX_FUNC_LEAVE(EX_FATAL);
+    }
+  }
+
+  EX_FUNC_LEAVE(warning ? EX_WARN : EX_NOERR);
+}
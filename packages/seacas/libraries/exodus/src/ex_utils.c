@@ -53,18 +53,35 @@
 #include "exodusII.h"
 #include "exodusII_int.h"
 
-struct obj_stats *exoII_eb  = 0;
-struct obj_stats *exoII_ed  = 0;
-struct obj_stats *exoII_fa  = 0;
-struct obj_stats *exoII_ns  = 0;
-struct obj_stats *exoII_es  = 0;
-struct obj_stats *exoII_fs  = 0;
-struct obj_stats *exoII_ss  = 0;
-struct obj_stats *exoII_els = 0;
-struct obj_stats *exoII_em  = 0;
-struct obj_stats *exoII_edm = 0;
-struct obj_stats *exoII_fam = 0;
-struct obj_stats *exoII_nm  = 0;
+struct obj_stats_table exoII_eb  = {NULL, 0, 0};
+struct obj_stats_table exoII_ed  = {NULL, 0, 0};
+struct obj_stats_table exoII_fa  = {NULL, 0, 0};
+struct obj_stats_table exoII_ns  = {NULL, 0, 0};
+struct obj_stats_table exoII_es  = {NULL, 0, 0};
+struct obj_stats_table exoII_fs  = {NULL, 0, 0};
+struct obj_stats_table exoII_ss  = {NULL, 0, 0};
+struct obj_stats_table exoII_els = {NULL, 0, 0};
+struct obj_stats_table exoII_em  = {NULL, 0, 0};
+struct obj_stats_table exoII_edm = {NULL, 0, 0};
+struct obj_stats_table exoII_fam = {NULL, 0, 0};
+struct obj_stats_table exoII_nm  = {NULL, 0, 0};
+
+/* Initial bucket count of the per-file hash tables; must be a power of two */
+#define EX_FILE_TABLE_INIT_SIZE 16
+
+/*! \internal
+ * Hash an exodus file id into a bucket index.  The netCDF file index
+ * lives in the upper 16 bits of the id and the group index in the
+ * lower 16 bits, so both halves are mixed before masking.
+ */
+size_t ex_hash_file_id(int exoid)
+{
+  unsigned int h = (unsigned int)exoid;
+  h ^= h >> 16;
+  h *= 0x45d9f3bU;
+  h ^= h >> 16;
+  return (size_t)h;
+}
 
 /*****************************************************************************
  *
@@ -521,6 +538,142 @@ char *ex_name_of_map(ex_entity_type map_type, int map_index)
   }
 }
 
+/*! \internal
+ * If the database has a time-history copy (see ex_put_time_history())
+ * of the results variable `varid`, return its variable id and the
+ * number of leading time steps for which it still matches the
+ * per-step layout.  Returns NC_NOERR on success and a netCDF error
+ * code (not reported) if there is no copy.
+ */
+int ex_get_time_history_varid(int exoid, int varid, int *hist_varid, size_t *hist_steps)
+{
+  char name[NC_MAX_NAME + 1];
+  char hist_name[NC_MAX_NAME + 1];
+  int  dimid;
+  int  valid_steps;
+  int  status;
+
+  if ((status = nc_inq_dimid(exoid, DIM_TIME_HIST, &dimid)) != NC_NOERR) {
+    return status;
+  }
+  if ((status = nc_inq_dimlen(exoid, dimid, hist_steps)) != NC_NOERR) {
+    return status;
+  }
+  if ((status = nc_get_att_int(exoid, NC_GLOBAL, ATT_TIME_HIST_VALID, &valid_steps)) !=
+      NC_NOERR) {
+    return status;
+  }
+  if (valid_steps < 0) {
+    valid_steps = 0;
+  }
+  if ((size_t)valid_steps < *hist_steps) {
+    *hist_steps = valid_steps;
+  }
+  if ((status = nc_inq_varname(exoid, varid, name)) != NC_NOERR) {
+    return status;
+  }
+  if (strlen(name) + strlen(VAR_HIST_SUFFIX) > NC_MAX_NAME) {
+    return NC_ENOTVAR;
+  }
+  snprintf(hist_name, sizeof(hist_name), "%s%s", name, VAR_HIST_SUFFIX);
+  return nc_inq_varid(exoid, hist_name, hist_varid);
+}
+
+/*! \internal
+ * Called by the functions writing results variables before the values
+ * of `time_step` are written.  If the database has a time-history copy
+ * (see ex_put_time_history()) which covers that step, the copy no
+ * longer matches the per-step layout from that step on, so the number
+ * of steps it is valid for is lowered to `time_step - 1`.
+ */
+void ex_invalidate_time_history(int exoid, int time_step)
+{
+  char                 errmsg[MAX_ERR_LENGTH];
+  int                  valid_steps;
+  int                  status;
+  struct ex_file_item *file = ex_find_file_item(exoid);
+
+  /* The number of valid steps is cached when the file is opened and
+   * when the copy is written, so files without a copy return here. */
+  if (file == NULL || time_step > file->time_hist_steps) {
+    return;
+  }
+
+  /* The attribute already exists and keeps its size, so it can be
+   * changed without entering define mode. */
+  valid_steps = time_step - 1;
+  if ((status = nc_put_att_int(exoid, NC_GLOBAL, ATT_TIME_HIST_VALID, NC_INT, 1, &valid_steps)) !=
+      NC_NOERR) {
+    snprintf(errmsg, MAX_ERR_LENGTH,
+             "ERROR: failed to invalidate time history copy at step %d in file id %d", time_step,
+             exoid);
+    ex_err(__func__, errmsg, status);
+    return;
+  }
+  file->time_hist_steps = valid_steps;
+}
+
+/*! \internal Hash an entity id for the ex_id_lkup() index */
+static size_t ex_hash_id(int64_t id)
+{
+  uint64_t h = (uint64_t)id * 0x9E3779B97F4A7C15ULL;
+  return (size_t)(h ^ (h >> 29));
+}
+
+/*! \internal
+ * Build an open-addressed hash of `stats->id_vals` so that ex_id_lkup()
+ * does not have to search the id array linearly on every call.  Only
+ * done once the id array is completely filled (`valid_ids`), since the
+ * ids are then fixed until the file is closed.  If the allocation fails,
+ * ex_id_lkup() simply falls back to the linear search.
+ */
+static void ex_build_id_index(struct obj_stats *stats)
+{
+  size_t i;
+  size_t size = 16;
+  while (size < 2 * (size_t)stats->num) {
+    size *= 2;
+  }
+
+  stats->id_index = calloc(size, sizeof(size_t));
+  if (stats->id_index == NULL) {
+    stats->id_index_size = 0;
+    return;
+  }
+  stats->id_index_size = size;
+
+  for (i = 0; i < (size_t)stats->num; i++) {
+    size_t slot = ex_hash_id(stats->id_vals[i]) & (size - 1);
+    while (stats->id_index[slot] != 0) {
+      if (stats->id_vals[stats->id_index[slot] - 1] == stats->id_vals[i]) {
+        break; /* duplicate id; keep the first occurrence as the linear search did */
+      }
+      slot = (slot + 1) & (size - 1);
+    }
+    if (stats->id_index[slot] == 0) {
+      stats->id_index[slot] = i + 1;
+    }
+  }
+}
+
+/*! \internal
+ * Returns the 0-based position of `id` in `stats->id_vals`, or
+ * `stats->num` if it is not present.
+ */
+static size_t ex_find_id_index(const struct obj_stats *stats, int64_t id)
+{
+  size_t mask = stats->id_index_size - 1;
+  size_t slot = ex_hash_id(id) & mask;
+  while (stats->id_index[slot] != 0) {
+    size_t idx = stats->id_index[slot] - 1;
+    if (stats->id_vals[idx] == id) {
+      return idx;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return (size_t)stats->num;
+}
+
 /*****************************************************************************
 *
 * ex_id_lkup - look up id
@@ -636,6 +789,10 @@ int ex_id_lkup(int exoid, ex_entity_type id_type, ex_entity_id num)
     return (EX_FATAL);
   }
 
+  if (tmp_stats == NULL) {
+    return (EX_FATAL); /* error reported by ex_get_stat_ptr */
+  }
+
   if ((tmp_stats->id_vals == NULL) || (!(tmp_stats->valid_ids))) {
 
     /* first time thru or id arrays haven't been completely filled yet */
@@ -719,6 +876,7 @@ int ex_id_lkup(int exoid, ex_entity_type id_type, ex_entity_id num)
       tmp_stats->valid_ids = EX_TRUE;
       tmp_stats->num       = dim_len;
       tmp_stats->id_vals   = id_vals;
+      ex_build_id_index(tmp_stats);
     }
   }
   else {
@@ -726,12 +884,16 @@ int ex_id_lkup(int exoid, ex_entity_type id_type, ex_entity_id num)
     dim_len = tmp_stats->num;
   }
 
-  /* Do a linear search through the id array to find the array value
-     corresponding to the passed index number */
-
-  for (i = 0; i < dim_len; i++) {
-    if (id_vals[i] == num) {
-      break; /* found the id requested */
+  if (tmp_stats->id_index != NULL) {
+    i = ex_find_id_index(tmp_stats, num);
+  }
+  else {
+    /* Do a linear search through the id array to find the array value
+       corresponding to the passed index number */
+    for (i = 0; i < dim_len; i++) {
+      if (id_vals[i] == num) {
+        break; /* found the id requested */
+      }
     }
   }
   if (i >= dim_len) /* failed to find id number */
@@ -802,6 +964,36 @@ int ex_id_lkup(int exoid, ex_entity_type id_type, ex_entity_id num)
   return (i + 1); /* return index into id array (1-based) */
 }
 
+/*! \internal
+ * Double the number of buckets in `table` and rehash its entries.  If
+ * the allocation fails the table is left as is; once the table has
+ * buckets, lookups stay correct and the chains are just longer, but the
+ * first growth must be checked by the caller (`size` is still 0).
+ */
+static void ex_grow_stats_table(struct obj_stats_table *table)
+{
+  size_t             i;
+  size_t             new_size = table->size == 0 ? EX_FILE_TABLE_INIT_SIZE : 2 * table->size;
+  struct obj_stats **buckets  = calloc(new_size, sizeof(struct obj_stats *));
+  if (buckets == NULL) {
+    return;
+  }
+
+  for (i = 0; i < table->size; i++) {
+    struct obj_stats *ptr = table->buckets[i];
+    while (ptr) {
+      struct obj_stats *next = ptr->next;
+      size_t            slot = ex_hash_file_id(ptr->exoid) & (new_size - 1);
+      ptr->next              = buckets[slot];
+      buckets[slot]          = ptr;
+      ptr                    = next;
+    }
+  }
+  free(table->buckets);
+  table->buckets = buckets;
+  table->size    = new_size;
+}
+
 /******************************************************************************
  *
  * ex_get_stat_ptr - returns a pointer to a structure of object ids
@@ -810,14 +1002,19 @@ int ex_id_lkup(int exoid, ex_entity_type id_type, ex_entity_id num)
 
 /*! this routine returns a pointer to a structure containing the ids of
  * element blocks, node sets, or side sets according to exoid;  if there
- * is not a structure that matches the exoid, one is created
+ * is not a structure that matches the exoid, one is created.  Returns
+ * NULL if the memory for a new structure cannot be allocated.
  */
 
-struct obj_stats *ex_get_stat_ptr(int exoid, struct obj_stats **obj_ptr)
+struct obj_stats *ex_get_stat_ptr(int exoid, struct obj_stats_table *obj_ptr)
 {
-  struct obj_stats *tmp_ptr;
+  struct obj_stats *tmp_ptr = NULL;
+  size_t            slot;
+  char              errmsg[MAX_ERR_LENGTH];
 
-  tmp_ptr = *obj_ptr;
+  if (obj_ptr->size > 0) {
+    tmp_ptr = obj_ptr->buckets[ex_hash_file_id(exoid) & (obj_ptr->size - 1)];
+  }
 
   while (tmp_ptr) {
     if ((tmp_ptr)->exoid == exoid) {
@@ -827,15 +1024,30 @@ struct obj_stats *ex_get_stat_ptr(int exoid, struct obj_stats **obj_ptr)
   }
 
   if (!tmp_ptr) { /* exoid not found */
-    tmp_ptr             = (struct obj_stats *)calloc(1, sizeof(struct obj_stats));
-    tmp_ptr->exoid      = exoid;
-    tmp_ptr->next       = *obj_ptr;
-    tmp_ptr->id_vals    = 0;
-    tmp_ptr->stat_vals  = 0;
-    tmp_ptr->num        = 0;
-    tmp_ptr->valid_ids  = 0;
-    tmp_ptr->valid_stat = 0;
-    *obj_ptr            = tmp_ptr;
+    if (obj_ptr->count >= obj_ptr->size) {
+      ex_grow_stats_table(obj_ptr);
+    }
+    if (obj_ptr->size > 0) {
+      tmp_ptr = (struct obj_stats *)calloc(1, sizeof(struct obj_stats));
+    }
+    if (tmp_ptr == NULL) {
+      snprintf(errmsg, MAX_ERR_LENGTH,
+               "ERROR: failed to allocate memory for object ids of file id %d", exoid);
+      ex_err(__func__, errmsg, EX_MEMFAIL);
+      return NULL;
+    }
+    slot                   = ex_hash_file_id(exoid) & (obj_ptr->size - 1);
+    tmp_ptr->exoid         = exoid;
+    tmp_ptr->next          = obj_ptr->buckets[slot];
+    tmp_ptr->id_vals       = 0;
+    tmp_ptr->stat_vals     = 0;
+    tmp_ptr->id_index      = 0;
+    tmp_ptr->id_index_size = 0;
+    tmp_ptr->num           = 0;
+    tmp_ptr->valid_ids     = 0;
+    tmp_ptr->valid_stat    = 0;
+    obj_ptr->buckets[slot] = tmp_ptr;
+    obj_ptr->count++;
   }
   return tmp_ptr;
 }
@@ -852,50 +1064,77 @@ struct obj_stats *ex_get_stat_ptr(int exoid, struct obj_stats **obj_ptr)
  * called from ex_close
  */
 
-void ex_rm_stat_ptr(int exoid, struct obj_stats **obj_ptr)
+void ex_rm_stat_ptr(int exoid, struct obj_stats_table *obj_ptr)
 {
-  struct obj_stats *last_head_list_ptr, *tmp_ptr;
+  struct obj_stats **link;
 
-  tmp_ptr            = *obj_ptr;
-  last_head_list_ptr = *obj_ptr; /* save last head pointer */
+  if (obj_ptr->size == 0) {
+    return;
+  }
 
-  while (tmp_ptr) /* Walk linked list of file ids/vals */
+  link = &obj_ptr->buckets[ex_hash_file_id(exoid) & (obj_ptr->size - 1)];
+  while (*link) /* Walk chain of file ids/vals in this bucket */
   {
-    if (exoid == tmp_ptr->exoid) /* linear search for exodus file id */
-    {
-      if (tmp_ptr == *obj_ptr) {     /* Are we at the head of the list? */
-        *obj_ptr = (*obj_ptr)->next; /*   yes, reset ptr to head of list */
-      }
-      else { /*   no, remove this record from chain*/
-        last_head_list_ptr->next = tmp_ptr->next;
-      }
+    struct obj_stats *tmp_ptr = *link;
+    if (exoid == tmp_ptr->exoid) {
+      *link = tmp_ptr->next; /* remove this record from chain */
       free(tmp_ptr->id_vals); /* free up memory */
       free(tmp_ptr->stat_vals);
+      free(tmp_ptr->id_index);
       free(tmp_ptr);
+      obj_ptr->count--;
       break; /* Quit if found */
     }
-    last_head_list_ptr = tmp_ptr;       /* save last head pointer */
-    tmp_ptr            = tmp_ptr->next; /* Loop back if not */
+    link = &tmp_ptr->next; /* Loop back if not */
   }
 }
 
+/*! \internal
+ * Double the number of buckets in `table` and rehash its entries.  If
+ * the allocation fails the table is left as is; the caller must check
+ * for a table that still has no buckets.
+ */
+static void ex_grow_list_table(struct list_table *table)
+{
+  size_t             i;
+  size_t             new_size = table->size == 0 ? EX_FILE_TABLE_INIT_SIZE : 2 * table->size;
+  struct list_item **buckets  = calloc(new_size, sizeof(struct list_item *));
+  if (buckets == NULL) {
+    return;
+  }
+
+  for (i = 0; i < table->size; i++) {
+    struct list_item *ptr = table->buckets[i];
+    while (ptr) {
+      struct list_item *next = ptr->next;
+      size_t            slot = ex_hash_file_id(ptr->exo_id) & (new_size - 1);
+      ptr->next              = buckets[slot];
+      buckets[slot]          = ptr;
+      ptr                    = next;
+    }
+  }
+  free(table->buckets);
+  table->buckets = buckets;
+  table->size    = new_size;
+}
+
 /* structures to hold number of blocks of that type for each file id */
-static struct list_item *ed_ctr_list = 0; /* edge blocks */
-static struct list_item *fa_ctr_list = 0; /* face blocks */
-static struct list_item *eb_ctr_list = 0; /* element blocks */
+static struct list_table ed_ctr_list = {NULL, 0, 0}; /* edge blocks */
+static struct list_table fa_ctr_list = {NULL, 0, 0}; /* face blocks */
+static struct list_table eb_ctr_list = {NULL, 0, 0}; /* element blocks */
 /* structures to hold number of sets of that type for each file id */
-static struct list_item *ns_ctr_list  = 0; /* node sets */
-static struct list_item *es_ctr_list  = 0; /* edge sets */
-static struct list_item *fs_ctr_list  = 0; /* face sets */
-static struct list_item *ss_ctr_list  = 0; /* side sets */
-static struct list_item *els_ctr_list = 0; /* element sets */
+static struct list_table ns_ctr_list  = {NULL, 0, 0}; /* node sets */
+static struct list_table es_ctr_list  = {NULL, 0, 0}; /* edge sets */
+static struct list_table fs_ctr_list  = {NULL, 0, 0}; /* face sets */
+static struct list_table ss_ctr_list  = {NULL, 0, 0}; /* side sets */
+static struct list_table els_ctr_list = {NULL, 0, 0}; /* element sets */
 /* structures to hold number of maps of that type for each file id */
-static struct list_item *nm_ctr_list  = 0; /* node maps */
-static struct list_item *edm_ctr_list = 0; /* edge maps */
-static struct list_item *fam_ctr_list = 0; /* face maps */
-static struct list_item *em_ctr_list  = 0; /* element maps */
+static struct list_table nm_ctr_list  = {NULL, 0, 0}; /* node maps */
+static struct list_table edm_ctr_list = {NULL, 0, 0}; /* edge maps */
+static struct list_table fam_ctr_list = {NULL, 0, 0}; /* face maps */
+static struct list_table em_ctr_list  = {NULL, 0, 0}; /* element maps */
 
-struct list_item **ex_get_counter_list(ex_entity_type obj_type)
+struct list_table *ex_get_counter_list(ex_entity_type obj_type)
 {
   /* Thread-safe, but is dealing with globals */
   /* Only called from a routine which will be using locks */
@@ -926,11 +1165,13 @@ struct list_item **ex_get_counter_list(ex_entity_type obj_type)
  * each open exodus file.  it is designed to be used by the routines
  * ex_put_elem_block() and ex_put_set_param(),
  * to keep track of the number of element blocks, and each type of set,
- * respectively, for each open exodus II file.
+ * respectively, for each open exodus II file.  Returns EX_FATAL if the
+ * counter for a new file id cannot be allocated.
  *
- * The list structure is used as follows:
+ * The items are kept in a table hashed on the exodus file id; each
+ * bucket holds a chain of list items:
  *
- *   ptr -----------> list item structure
+ *   bucket --------> list item structure
  *                    -------------------
  *                    exodus file id
  *                    item value (int)
@@ -939,27 +1180,46 @@ struct list_item **ex_get_counter_list(ex_entity_type obj_type)
  *
  * NOTE: since netCDF reuses its file ids, and a user may open and close any
  *       number of files in one application, items must be taken out of the
- *       linked lists in each of the above routines.  these should be called
+ *       tables in each of the above routines.  these should be called
  *       after ncclose().
  */
 
 int ex_inc_file_item(int                exoid,    /* file id */
-                     struct list_item **list_ptr) /* ptr to ptr to list_item */
+                     struct list_table *list_ptr) /* ptr to table of list_items */
 {
-  struct list_item *tlist_ptr = *list_ptr; /* use temp list ptr to walk linked list */
-  while (tlist_ptr) {                      /* Walk linked list of file ids/vals */
-    if (exoid == tlist_ptr->exo_id) {      /* linear search for exodus file id */
-      break;                               /* Quit if found */
+  struct list_item *tlist_ptr = NULL;
+  size_t            slot;
+  char              errmsg[MAX_ERR_LENGTH];
+
+  if (list_ptr->size > 0) { /* Walk the chain of file ids/vals in this bucket */
+    tlist_ptr = list_ptr->buckets[ex_hash_file_id(exoid) & (list_ptr->size - 1)];
+  }
+  while (tlist_ptr) {
+    if (exoid == tlist_ptr->exo_id) { /* search for exodus file id */
+      break;                          /* Quit if found */
     }
     tlist_ptr = tlist_ptr->next; /* Loop back if not */
   }
 
   if (!tlist_ptr) { /* ptr NULL? */
+    if (list_ptr->count >= list_ptr->size) {
+      ex_grow_list_table(list_ptr);
+    }
     /* allocate space for new structure record */
-    tlist_ptr         = (struct list_item *)calloc(1, sizeof(struct list_item));
-    tlist_ptr->exo_id = exoid;     /* insert file id */
-    tlist_ptr->next   = *list_ptr; /* insert into head of list */
-    *list_ptr         = tlist_ptr; /* fix up new head of list  */
+    if (list_ptr->size > 0) {
+      tlist_ptr = (struct list_item *)calloc(1, sizeof(struct list_item));
+    }
+    if (tlist_ptr == NULL) {
+      snprintf(errmsg, MAX_ERR_LENGTH,
+               "ERROR: failed to allocate memory for item counter of file id %d", exoid);
+      ex_err(__func__, errmsg, EX_MEMFAIL);
+      return (EX_FATAL);
+    }
+    slot                    = ex_hash_file_id(exoid) & (list_ptr->size - 1);
+    tlist_ptr->exo_id       = exoid;                   /* insert file id */
+    tlist_ptr->next         = list_ptr->buckets[slot]; /* insert into head of chain */
+    list_ptr->buckets[slot] = tlist_ptr;
+    list_ptr->count++;
   }
   return (tlist_ptr->value++);
 }
@@ -976,9 +1236,10 @@ int ex_inc_file_item(int                exoid,    /* file id */
  * to get the number of element blocks, or a type of set,
  * respectively, for an open exodus II file.
  *
- * The list structure is used as follows:
+ * The items are kept in a table hashed on the exodus file id; each
+ * bucket holds a chain of list items:
  *
- *   ptr -----------> list item structure
+ *   bucket --------> list item structure
  *                    -------------------
  *                    exodus file id
  *                    item value (int)
@@ -987,21 +1248,24 @@ int ex_inc_file_item(int                exoid,    /* file id */
  *
  * NOTE: since netCDF reuses its file ids, and a user may open and close any
  *       number of files in one application, items must be taken out of the
- *       linked lists in each of the above routines.  these should be called
+ *       tables in each of the above routines.  these should be called
  *       after nc_close().
  */
 
 int ex_get_file_item(int                exoid,    /* file id */
-                     struct list_item **list_ptr) /* ptr to ptr to list_item */
+                     struct list_table *list_ptr) /* ptr to table of list_items */
 {
   /* Not thread-safe: list_ptr passed in is a global
    * Would probably work ok with multiple threads since read-only,
    * but possible that list_ptr will be modified while being used
    */
-  struct list_item *tlist_ptr = *list_ptr; /* use temp list ptr to walk linked list */
-  while (tlist_ptr) {                      /* Walk linked list of file ids/vals */
-    if (exoid == tlist_ptr->exo_id) {      /* linear search for exodus file id */
-      break;                               /* Quit if found */
+  struct list_item *tlist_ptr = NULL;
+  if (list_ptr->size > 0) { /* Walk the chain of file ids/vals in this bucket */
+    tlist_ptr = list_ptr->buckets[ex_hash_file_id(exoid) & (list_ptr->size - 1)];
+  }
+  while (tlist_ptr) {
+    if (exoid == tlist_ptr->exo_id) { /* search for exodus file id */
+      break;                          /* Quit if found */
     }
     tlist_ptr = tlist_ptr->next; /* Loop back if not */
   }
@@ -1022,9 +1286,10 @@ int ex_get_file_item(int                exoid,    /* file id */
 /*! this routine removes a structure to track and increment a counter for
  * each open exodus file.
  *
- * The list structure is used as follows:
+ * The items are kept in a table hashed on the exodus file id; each
+ * bucket holds a chain of list items:
  *
- *   ptr -----------> list item structure
+ *   bucket --------> list item structure
  *                    -------------------
  *                    exodus file id
  *                    item value (int)
@@ -1033,30 +1298,30 @@ int ex_get_file_item(int                exoid,    /* file id */
  *
  * NOTE: since netCDF reuses its file ids, and a user may open and close any
  *       number of files in one application, items must be taken out of the
- *       linked lists in each of the above routines.  these should be called
+ *       tables in each of the above routines.  these should be called
  *       after ncclose().
  */
 
 void ex_rm_file_item(int                exoid,    /* file id */
-                     struct list_item **list_ptr) /* ptr to ptr to list_item */
+                     struct list_table *list_ptr) /* ptr to table of list_items */
 
 {
-  struct list_item *last_head_list_ptr = *list_ptr; /* save last head pointer */
+  struct list_item **link;
 
-  struct list_item *tlist_ptr = *list_ptr;
-  while (tlist_ptr) {                  /* Walk linked list of file ids/vals */
-    if (exoid == tlist_ptr->exo_id) {  /* linear search for exodus file id */
-      if (tlist_ptr == *list_ptr) {    /* Are we at the head of the list? */
-        *list_ptr = (*list_ptr)->next; /*   yes, reset ptr to head of list */
-      }
-      else { /*   no, remove this record from chain*/
-        last_head_list_ptr->next = tlist_ptr->next;
-      }
-      free(tlist_ptr); /* free up memory */
-      break;           /* Quit if found */
+  if (list_ptr->size == 0) {
+    return;
+  }
+
+  link = &list_ptr->buckets[ex_hash_file_id(exoid) & (list_ptr->size - 1)];
+  while (*link) { /* Walk chain of file ids/vals in this bucket */
+    struct list_item *tlist_ptr = *link;
+    if (exoid == tlist_ptr->exo_id) { /* search for exodus file id */
+      *link = tlist_ptr->next;        /* remove this record from chain */
+      free(tlist_ptr);                /* free up memory */
+      list_ptr->count--;
+      break; /* Quit if found */
     }
-    last_head_list_ptr = tlist_ptr;       /* save last head pointer */
-    tlist_ptr          = tlist_ptr->next; /* Loop back if not */
+    link = &tlist_ptr->next; /* Loop back if not */
   }
 }
 
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2005-2017 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above
+ *       copyright notice, this list of conditions and the following
+ *       disclaimer in the documentation and/or other materials provided
+ *       with the distribution.
+ *
+ *     * Neither the name of NTESS nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*****************************************************************************
+ *
+ * bench_put_vars - time per-step output of element and nodal variables
+ *                  using one ex_put_var() call per variable per block
+ *                  versus a single ex_put_vars() call per entity type.
+ *
+ * usage: bench_put_vars [num_blocks [num_vars [num_elem_per_block [num_steps]]]]
+ *
+ *  Both files are read back and compared; returns nonzero on mismatch.
+ *
+ *****************************************************************************/
+
+#include "exodusII.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+static double wall_time(void)
+{
+  struct timeval tp;
+  gettimeofday(&tp, NULL);
+  return (double)tp.tv_sec + (double)tp.tv_usec * 1.0e-6;
+}
+
+#define EXCHECK(funcall)                                                                           \
+  do {                                                                                             \
+    int error = (funcall);                                                                         \
+    if (error != EX_NOERR) {                                                                       \
+      fprintf(stderr, "Error calling %s\n", #funcall);                                             \
+      ex_close(exoid);                                                                             \
+      exit(-1);                                                                                    \
+    }                                                                                              \
+  } while (0)
+
+static int create_file(const char *filename, int num_blocks, int num_vars, int num_per_block)
+{
+  int CPU_word_size = 8;
+  int IO_word_size  = 8;
+  int exoid = ex_create(filename, EX_CLOBBER, &CPU_word_size, &IO_word_size);
+  int b;
+  int num_elem = num_blocks * num_per_block;
+
+  int *truth_tab = malloc(num_blocks * num_vars * sizeof(int));
+  for (b = 0; b < num_blocks * num_vars; b++) {
+    truth_tab[b] = 1;
+  }
+
+  EXCHECK(ex_put_init(exoid, "bench_put_vars", 3, num_elem, num_elem, num_blocks, 0, 0));
+  for (b = 0; b < num_blocks; b++) {
+    EXCHECK(ex_put_block(exoid, EX_ELEM_BLOCK, b + 1, "sphere", num_per_block, 1, 0, 0, 0));
+  }
+  EXCHECK(ex_put_variable_param(exoid, EX_ELEM_BLOCK, num_vars));
+  EXCHECK(ex_put_variable_param(exoid, EX_NODAL, num_vars));
+  EXCHECK(ex_put_truth_table(exoid, EX_ELEM_BLOCK, num_blocks, num_vars, truth_tab));
+  free(truth_tab);
+  return exoid;
+}
+
+static void fill_values(double *vals, int step, size_t count)
+{
+  size_t i;
+  for (i = 0; i < count; i++) {
+    vals[i] = step + (double)i * 1.0e-3;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  int num_blocks    = argc > 1 ? atoi(argv[1]) : 80;
+  int num_vars      = argc > 2 ? atoi(argv[2]) : 300;
+  int num_per_block = argc > 3 ? atoi(argv[3]) : 10;
+  int num_steps     = argc > 4 ? atoi(argv[4]) : 5;
+  int num_elem      = num_blocks * num_per_block;
+  int exoid, b, v, step;
+  int mismatch = 0;
+
+  size_t       elem_count  = (size_t)num_blocks * num_vars * num_per_block;
+  size_t       nodal_count = (size_t)num_vars * num_elem;
+  double *     elem_vals   = malloc(elem_count * sizeof(double));
+  double *     nodal_vals  = malloc(nodal_count * sizeof(double));
+  double *     read_vals   = malloc(num_elem * sizeof(double));
+  double *     check_vals  = malloc(num_elem * sizeof(double));
+  ex_var_data *vars        = malloc(2 * (size_t)num_blocks * num_vars * sizeof(ex_var_data));
+  double       single_time = 0.0;
+  double       batch_time  = 0.0;
+
+  ex_opts(EX_VERBOSE | EX_ABORT);
+
+  /* One ex_put_var() call per variable per block */
+  exoid = create_file("bench_put_var.exo", num_blocks, num_vars, num_per_block);
+  for (step = 1; step <= num_steps; step++) {
+    double time_value = step;
+    double start;
+    fill_values(elem_vals, step, elem_count);
+    fill_values(nodal_vals, -step, nodal_count);
+
+    start = wall_time();
+    EXCHECK(ex_put_time(exoid, step, &time_value));
+    for (v = 0; v < num_vars; v++) {
+      EXCHECK(ex_put_var(exoid, step, EX_NODAL, v + 1, 1, num_elem,
+                         &nodal_vals[(size_t)v * num_elem]));
+    }
+    for (b = 0; b < num_blocks; b++) {
+      for (v = 0; v < num_vars; v++) {
+        size_t offset = ((size_t)b * num_vars + v) * num_per_block;
+        EXCHECK(ex_put_var(exoid, step, EX_ELEM_BLOCK, v + 1, b + 1, num_per_block,
+                           &elem_vals[offset]));
+      }
+    }
+    single_time += wall_time() - start;
+  }
+  EXCHECK(ex_close(exoid));
+
+  /* One ex_put_vars() call per entity type; each block variable is
+   * passed as two halves to exercise hyperslab coalescing. */
+  exoid = create_file("bench_put_vars.exo", num_blocks, num_vars, num_per_block);
+  for (step = 1; step <= num_steps; step++) {
+    double time_value = step;
+    double start;
+    size_t n = 0;
+    fill_values(elem_vals, step, elem_count);
+    fill_values(nodal_vals, -step, nodal_count);
+
+    start = wall_time();
+    EXCHECK(ex_put_time(exoid, step, &time_value));
+    for (v = 0; v < num_vars; v++) {
+      vars[v].id          = 0;
+      vars[v].var_index   = v + 1;
+      vars[v].start_index = 1;
+      vars[v].num_entry   = num_elem;
+      vars[v].values      = &nodal_vals[(size_t)v * num_elem];
+    }
+    EXCHECK(ex_put_vars(exoid, step, EX_NODAL, num_vars, vars));
+
+    for (b = 0; b < num_blocks; b++) {
+      for (v = 0; v < num_vars; v++) {
+        size_t offset = ((size_t)b * num_vars + v) * num_per_block;
+        int    half   = num_per_block / 2;
+
+        vars[n].id          = b + 1;
+        vars[n].var_index   = v + 1;
+        vars[n].start_index = 1;
+        vars[n].num_entry   = half;
+        vars[n].values      = &elem_vals[offset];
+        n++;
+
+        vars[n].id          = b + 1;
+        vars[n].var_index   = v + 1;
+        vars[n].start_index = half + 1;
+        vars[n].num_entry   = num_per_block - half;
+        vars[n].values      = &elem_vals[offset + half];
+        n++;
+      }
+    }
+    EXCHECK(ex_put_vars(exoid, step, EX_ELEM_BLOCK, n, vars));
+    batch_time += wall_time() - start;
+  }
+  EXCHECK(ex_close(exoid));
+
+  /* Verify the two files contain the same data. */
+  {
+    int CPU_word_size = 8;
+    int IO_word_size  = 0;
+    float version;
+    int   exo1 = ex_open("bench_put_var.exo", EX_READ, &CPU_word_size, &IO_word_size, &version);
+    int   exo2 = ex_open("bench_put_vars.exo", EX_READ, &CPU_word_size, &IO_word_size, &version);
+    int   i;
+
+    for (step = 1; step <= num_steps && !mismatch; step++) {
+      for (v = 1; v <= num_vars && !mismatch; v++) {
+        ex_get_var(exo1, step, EX_NODAL, v, 1, num_elem, read_vals);
+        ex_get_var(exo2, step, EX_NODAL, v, 1, num_elem, check_vals);
+        for (i = 0; i < num_elem; i++) {
+          if (read_vals[i] != check_vals[i]) {
+            mismatch = 1;
+          }
+        }
+        for (b = 1; b <= num_blocks; b++) {
+          ex_get_var(exo1, step, EX_ELEM_BLOCK, v, b, num_per_block, read_vals);
+          ex_get_var(exo2, step, EX_ELEM_BLOCK, v, b, num_per_block, check_vals);
+          for (i = 0; i < num_per_block; i++) {
+            if (read_vals[i] != check_vals[i]) {
+              mismatch = 1;
+            }
+          }
+        }
+      }
+    }
+    ex_close(exo1);
+    ex_close(exo2);
+  }
+
+  printf("Blocks: %d, Variables: %d, Elements/block: %d, Steps: %d\n", num_blocks, num_vars,
+         num_per_block, num_steps);
+  printf("ex_put_var  (%d calls/step): %10.6f seconds/step\n", num_vars * (num_blocks + 1),
+         single_time / num_steps);
+  printf("ex_put_vars (2 calls/step):    %10.6f seconds/step\n", batch_time / num_steps);
+  if (mismatch) {
+    printf("ERROR: ex_put_var and ex_put_vars output differ\n");
+  }
+
+  free(elem_vals);
+  free(nodal_vals);
+  free(read_vals);
+  free(check_vals);
+  free(vars);
+  return mismatch;
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2005-2017 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above
+ *       copyright notice, this list of conditions and the following
+ *       disclaimer in the documentation and/or other materials provided
+ *       with the distribution.
+ *
+ *     * Neither the name of NTESS nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*****************************************************************************
+ *
+ * bench_var_time - time ex_get_var_time() reads of single entities through
+ *                  all time steps, with and without the time-history copy
+ *                  written by ex_put_time_history().
+ *
+ * usage: bench_var_time [num_elem [num_steps [num_reads]]]
+ *
+ *  Every value read is checked against the value that was written;
+ *  returns nonzero on mismatch.  The file with the time-history copy
+ *  also gets one more step appended afterwards to check that reads
+ *  past the end of the copy fall back to the per-step layout, and then
+ *  has a step rewritten to check that the copy is no longer used for it.
+ *
+ *****************************************************************************/
+
+#include "exodusII.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+static double wall_time(void)
+{
+  struct timeval tp;
+  gettimeofday(&tp, NULL);
+  return (double)tp.tv_sec + (double)tp.tv_usec * 1.0e-6;
+}
+
+#define EXCHECK(funcall)                                                                           \
+  do {                                                                                             \
+    int error = (funcall);                                                                         \
+    if (error != EX_NOERR) {                                                                       \
+      fprintf(stderr, "Error calling %s\n", #funcall);                                             \
+      ex_close(exoid);                                                                             \
+      exit(-1);                                                                                    \
+    }                                                                                              \
+  } while (0)
+
+#define NUM_VARS 2
+
+/* Step whose values were rewritten after the time-history copy was made */
+static int rewritten_step = 0;
+
+static double value(int step, int entity, int var)
+{
+  return step * 1000.0 + entity * 1.0e-3 + var + (step == rewritten_step ? 0.5 : 0.0);
+}
+
+static void put_step(int exoid, int step, int num_elem, double *vals)
+{
+  double time_value = step;
+  double globals[NUM_VARS];
+  int    v, i;
+
+  EXCHECK(ex_put_time(exoid, step, &time_value));
+  for (v = 1; v <= NUM_VARS; v++) {
+    for (i = 0; i < num_elem; i++) {
+      vals[i] = value(step, i + 1, v);
+    }
+    EXCHECK(ex_put_var(exoid, step, EX_ELEM_BLOCK, v, 1, num_elem, vals));
+    EXCHECK(ex_put_var(exoid, step, EX_NODAL, v, 1, num_elem, vals));
+    globals[v - 1] = value(step, 1, v);
+  }
+  EXCHECK(ex_put_var(exoid, step, EX_GLOBAL, 1, 0, NUM_VARS, globals));
+}
+
+static void write_file(const char *filename, int num_elem, int num_steps, int time_history)
+{
+  int     CPU_word_size = 8;
+  int     IO_word_size  = 8;
+  int     exoid         = ex_create(filename, EX_CLOBBER, &CPU_word_size, &IO_word_size);
+  int     step;
+  double *vals = malloc(num_elem * sizeof(double));
+
+  EXCHECK(ex_put_init(exoid, "bench_var_time", 3, num_elem, num_elem, 1, 0, 0));
+  EXCHECK(ex_put_block(exoid, EX_ELEM_BLOCK, 1, "sphere", num_elem, 1, 0, 0, 0));
+  EXCHECK(ex_put_variable_param(exoid, EX_ELEM_BLOCK, NUM_VARS));
+  EXCHECK(ex_put_variable_param(exoid, EX_NODAL, NUM_VARS));
+  EXCHECK(ex_put_variable_param(exoid, EX_GLOBAL, NUM_VARS));
+  for (step = 1; step <= num_steps; step++) {
+    put_step(exoid, step, num_elem, vals);
+  }
+  if (time_history) {
+    EXCHECK(ex_set_option(exoid, EX_OPT_TIME_HISTORY, 1));
+  }
+  EXCHECK(ex_close(exoid));
+  free(vals);
+}
+
+/* Read `num_reads` random entity histories over steps [beg, end];
+ * returns the number of mismatched values. */
+static int read_histories(int exoid, int num_elem, int beg, int end, int num_reads, double *vals)
+{
+  static const ex_entity_type types[] = {EX_ELEM_BLOCK, EX_NODAL, EX_GLOBAL};
+  int                         r, s;
+  int                         errors = 0;
+
+  srand(1234);
+  for (r = 0; r < num_reads; r++) {
+    ex_entity_type type   = types[r % 3];
+    int            entity = type == EX_GLOBAL ? 1 : rand() % num_elem + 1;
+    int            var    = rand() % NUM_VARS + 1;
+
+    EXCHECK(ex_get_var_time(exoid, type, var, entity, beg, end, vals));
+    for (s = beg; s <= end; s++) {
+      if (vals[s - beg] != value(s, entity, var)) {
+        errors++;
+      }
+    }
+  }
+  return errors;
+}
+
+static int open_file(const char *filename, int mode)
+{
+  int   CPU_word_size = 8;
+  int   IO_word_size  = 0;
+  float version;
+  int   exoid = ex_open(filename, mode, &CPU_word_size, &IO_word_size, &version);
+  if (exoid < 0) {
+    fprintf(stderr, "Failed to open file %s\n", filename);
+    exit(-1);
+  }
+  return exoid;
+}
+
+int main(int argc, char **argv)
+{
+  int     num_elem  = argc > 1 ? atoi(argv[1]) : 1000;
+  int     num_steps = argc > 2 ? atoi(argv[2]) : 5000;
+  int     num_reads = argc > 3 ? atoi(argv[3]) : 300;
+  int     exoid;
+  int     errors = 0;
+  double  start, plain_time, hist_time, put_time;
+  double *vals = malloc((num_steps + 1) * sizeof(double));
+
+  ex_opts(EX_VERBOSE);
+
+  write_file("bench_var_time.exo", num_elem, num_steps, 0);
+  start = wall_time();
+  write_file("bench_var_time_hist.exo", num_elem, num_steps, 1);
+  put_time = wall_time() - start;
+
+  exoid = open_file("bench_var_time.exo", EX_READ);
+  start = wall_time();
+  errors += read_histories(exoid, num_elem, 1, num_steps, num_reads, vals);
+  plain_time = wall_time() - start;
+  EXCHECK(ex_close(exoid));
+
+  exoid = open_file("bench_var_time_hist.exo", EX_READ);
+  start = wall_time();
+  errors += read_histories(exoid, num_elem, 1, num_steps, num_reads, vals);
+  hist_time = wall_time() - start;
+  if (num_steps > 2) {
+    errors += read_histories(exoid, num_elem, 2, num_steps - 1, num_reads, vals);
+  }
+  EXCHECK(ex_close(exoid));
+
+  /* Append a step; reads through it must not use the (shorter) copy. */
+  exoid = open_file("bench_var_time_hist.exo", EX_WRITE);
+  put_step(exoid, num_steps + 1, num_elem, vals);
+  EXCHECK(ex_close(exoid));
+  exoid = open_file("bench_var_time_hist.exo", EX_READ);
+  errors += read_histories(exoid, num_elem, 1, num_steps + 1, num_reads, vals);
+  EXCHECK(ex_close(exoid));
+
+  /* Rewrite a step covered by the copy; reads must return the new values. */
+  if (num_steps > 2) {
+    rewritten_step = 2;
+    exoid          = open_file("bench_var_time_hist.exo", EX_WRITE);
+    put_step(exoid, rewritten_step, num_elem, vals);
+    EXCHECK(ex_close(exoid));
+    exoid = open_file("bench_var_time_hist.exo", EX_READ);
+    errors += read_histories(exoid, num_elem, 1, num_steps, num_reads, vals);
+    errors += read_histories(exoid, num_elem, 1, 1, num_reads, vals);
+    EXCHECK(ex_close(exoid));
+  }
+
+  fprintf(stderr, "%d entities, %d steps, %d histories read\n", num_elem, num_steps, num_reads);
+  fprintf(stderr, "  write incl. time history: %8.3f s\n", put_time);
+  fprintf(stderr, "  per-step layout:          %8.3f s\n", plain_time);
+  fprintf(stderr, "  time-history copy:        %8.3f s\n", hist_time);
+
+  free(vals);
+  if (errors > 0) {
+    fprintf(stderr, "%d values differ\n", errors);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2005-2017 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above
+ *       copyright notice, this list of conditions and the following
+ *       disclaimer in the documentation and/or other materials provided
+ *       with the distribution.
+ *
+ *     * Neither the name of NTESS nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*****************************************************************************
+ *
+ * stress_open_files - open many exodus files at once and perform random
+ *                     block and set lookups across them.  Exercises the
+ *                     per-file bookkeeping (ex_find_file_item, the entity
+ *                     counters, and ex_id_lkup) with a large number of
+ *                     simultaneously open files.
+ *
+ * usage: stress_open_files [num_files [num_blocks [num_lookups]]]
+ *
+ *  Defaults are 4096 files, 20 blocks and sets per file, and 200000
+ *  lookups.  If the process file descriptor limit is lower than the
+ *  requested number of files, the count is reduced to fit.
+ *
+ *****************************************************************************/
+
+#include "exodusII.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+static double wall_time(void)
+{
+  struct timeval tp;
+  gettimeofday(&tp, NULL);
+  return (double)tp.tv_sec + (double)tp.tv_usec * 1.0e-6;
+}
+
+#define EXCHECK(funcall)                                                                           \
+  do {                                                                                             \
+    int error = (funcall);                                                                         \
+    if (error != EX_NOERR) {                                                                       \
+      fprintf(stderr, "Error calling %s\n", #funcall);                                             \
+      exit(-1);                                                                                    \
+    }                                                                                              \
+  } while (0)
+
+/* Block and set ids are distinct in every file so a lookup routed to
+ * the wrong file's bookkeeping fails instead of silently succeeding. */
+static int64_t block_id(int file, int block) { return (int64_t)file * 1000 + 10 * block + 1; }
+static int64_t set_id(int file, int set) { return (int64_t)file * 1000 + 10 * set + 5; }
+
+/* Reduce `num_files` to what the process may open, raising the soft
+ * descriptor limit as far as allowed first. */
+static int limit_file_count(int num_files)
+{
+#if !defined(_WIN32)
+  struct rlimit limit;
+  if (getrlimit(RLIMIT_NOFILE, &limit) == 0) {
+    rlim_t want = (rlim_t)num_files + 32;
+    if (limit.rlim_cur < want) {
+      limit.rlim_cur = limit.rlim_max < want ? limit.rlim_max : want;
+      setrlimit(RLIMIT_NOFILE, &limit);
+      getrlimit(RLIMIT_NOFILE, &limit);
+    }
+    if (limit.rlim_cur < want) {
+      int avail = limit.rlim_cur > 32 ? (int)(limit.rlim_cur - 32) : 1;
+      fprintf(stderr, "Descriptor limit allows only %d open files; using that instead of %d\n",
+              avail, num_files);
+      num_files = avail;
+    }
+  }
+#endif
+  return num_files;
+}
+
+static int create_file(const char *filename, int file, int num_blocks)
+{
+  int     CPU_word_size = 8;
+  int     IO_word_size  = 8;
+  int     exoid         = ex_create(filename, EX_CLOBBER, &CPU_word_size, &IO_word_size);
+  int     b;
+  int     node          = 1;
+  double  coord         = 0.0;
+  int64_t num_elem      = num_blocks;
+
+  if (exoid < 0) {
+    fprintf(stderr, "Failed to create file %s\n", filename);
+    exit(-1);
+  }
+
+  EXCHECK(ex_put_init(exoid, "stress_open_files", 1, 1, num_elem, num_blocks, num_blocks, 0));
+  EXCHECK(ex_put_coord(exoid, &coord, NULL, NULL));
+
+  for (b = 0; b < num_blocks; b++) {
+    EXCHECK(ex_put_block(exoid, EX_ELEM_BLOCK, block_id(file, b), "SPHERE", 1, 1, 0, 0, 0));
+    EXCHECK(ex_put_conn(exoid, EX_ELEM_BLOCK, block_id(file, b), &node, NULL, NULL));
+  }
+  for (b = 0; b < num_blocks; b++) {
+    EXCHECK(ex_put_set_param(exoid, EX_NODE_SET, set_id(file, b), 1, 0));
+    EXCHECK(ex_put_set(exoid, EX_NODE_SET, set_id(file, b), &node, NULL));
+  }
+  return exoid;
+}
+
+int main(int argc, char **argv)
+{
+  int     num_files   = argc > 1 ? atoi(argv[1]) : 4096;
+  int     num_blocks  = argc > 2 ? atoi(argv[2]) : 20;
+  long    num_lookups = argc > 3 ? atol(argv[3]) : 200000;
+  int *   exoids;
+  int     f;
+  long    l;
+  int     errors = 0;
+  double  start, open_time, lookup_time, close_time;
+  char    filename[64];
+  int64_t num_entry, num_per_entry, num_edges, num_faces, num_attr, num_dist;
+  char    elem_type[MAX_STR_LENGTH + 1];
+
+  ex_opts(EX_VERBOSE);
+  num_files = limit_file_count(num_files);
+  exoids    = malloc(num_files * sizeof(int));
+
+  start = wall_time();
+  for (f = 0; f < num_files; f++) {
+    snprintf(filename, sizeof(filename), "stress_open_%05d.exo", f);
+    exoids[f] = create_file(filename, f, num_blocks);
+  }
+  open_time = wall_time() - start;
+
+  /* Counter lists: each file must report its own block and set count. */
+  for (f = 0; f < num_files; f++) {
+    if (ex_inquire_int(exoids[f], EX_INQ_ELEM_BLK) != num_blocks ||
+        ex_inquire_int(exoids[f], EX_INQ_NODE_SETS) != num_blocks) {
+      fprintf(stderr, "Wrong block or set count in file %d\n", f);
+      errors++;
+    }
+  }
+
+  srand(42);
+  start = wall_time();
+  for (l = 0; l < num_lookups; l++) {
+    f     = rand() % num_files;
+    int b = rand() % num_blocks;
+    if (l % 2 == 0) {
+      EXCHECK(ex_get_block(exoids[f], EX_ELEM_BLOCK, block_id(f, b), elem_type, &num_entry,
+                           &num_per_entry, &num_edges, &num_faces, &num_attr));
+      if (num_entry != 1 || num_per_entry != 1 || strncmp(elem_type, "SPHERE", 6) != 0) {
+        fprintf(stderr, "Wrong block %" PRId64 " read from file %d\n", block_id(f, b), f);
+        errors++;
+      }
+    }
+    else {
+      EXCHECK(ex_get_set_param(exoids[f], EX_NODE_SET, set_id(f, b), &num_entry, &num_dist));
+      if (num_entry != 1) {
+        fprintf(stderr, "Wrong set %" PRId64 " read from file %d\n", set_id(f, b), f);
+        errors++;
+      }
+    }
+  }
+  lookup_time = wall_time() - start;
+
+  start = wall_time();
+  for (f = 0; f < num_files; f++) {
+    EXCHECK(ex_close(exoids[f]));
+    snprintf(filename, sizeof(filename), "stress_open_%05d.exo", f);
+    remove(filename);
+  }
+  close_time = wall_time() - start;
+  free(exoids);
+
+  fprintf(stderr, "%d files, %d blocks and sets per file, %ld lookups\n", num_files, num_blocks,
+          num_lookups);
+  fprintf(stderr, "  create: %8.3f s\n  lookup: %8.3f s (%.2f us/lookup)\n  close:  %8.3f s\n",
+          open_time, lookup_time, num_lookups > 0 ? 1.0e6 * lookup_time / num_lookups : 0.0,
+          close_time);
+  if (errors > 0) {
+    fprintf(stderr, "%d lookup errors\n", errors);
+    return 1;
+  }
+  return 0;
+}
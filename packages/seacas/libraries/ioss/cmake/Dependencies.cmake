@@ -11,3 +11,4 @@ TRIBITS_PACKAGE_DEFINE_DEPENDENCIES(
 endif()
 
 TRIBITS_TPL_TENTATIVELY_ENABLE(DLlib)
+TRIBITS_TPL_TENTATIVELY_ENABLE(Pthread)
@@ -0,0 +1,93 @@
+// Copyright(C) 1999-2017 National Technology & Engineering Solutions
+// of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+// NTESS, the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of NTESS nor the names of its
+//       contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IOSS_Ioss_AsyncWriter_h
+#define IOSS_Ioss_AsyncWriter_h
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace Ioss {
+
+  /** \brief Executes queued output tasks in order on a dedicated I/O thread.
+   *
+   *  Used by databases supporting the `ASYNC_OUTPUT` property.  The
+   *  caller copies the data to be written into storage owned by the
+   *  task and passes the size of that storage to `enqueue`.  If the
+   *  staging memory held by the queued and running tasks would exceed
+   *  `max_bytes`, `enqueue` blocks until enough tasks have completed.
+   *
+   *  `fence` waits until all queued tasks have completed.  An
+   *  exception thrown by a task is rethrown on the calling thread at
+   *  the next `enqueue` or `fence`; tasks queued after the failing
+   *  task are discarded.
+   */
+  class AsyncWriter
+  {
+  public:
+    explicit AsyncWriter(size_t max_bytes);
+    AsyncWriter(const AsyncWriter &from) = delete;
+    AsyncWriter &operator=(const AsyncWriter &from) = delete;
+    ~AsyncWriter();
+
+    void enqueue(size_t bytes, std::function<void()> task);
+    void fence();
+
+    size_t max_bytes() const { return m_maxBytes; }
+    size_t high_water_bytes() const;
+
+  private:
+    void run();
+    void rethrow_error();
+
+    using Task = std::pair<size_t, std::function<void()>>;
+
+    std::thread             m_thread;
+    mutable std::mutex      m_mutex;
+    std::condition_variable m_taskQueued;
+    std::condition_variable m_taskDone;
+    std::deque<Task>        m_tasks;
+    std::exception_ptr      m_error;
+    size_t                  m_maxBytes;
+    size_t                  m_pendingBytes{0}; // Bytes held by queued and running tasks.
+    size_t                  m_highWater{0};
+    bool                    m_busy{false};
+    bool                    m_shutdown{false};
+  };
+} // namespace Ioss
+#endif
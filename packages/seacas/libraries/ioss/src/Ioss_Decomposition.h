@@ -36,11 +36,13 @@
 
 #include <Ioss_CodeTypes.h>
 #include <Ioss_Map.h>
+#include <Ioss_NeighborExchange.h>
 #include <Ioss_ParallelUtils.h>
 #include <Ioss_PropertyManager.h>
 #include <algorithm>
 #include <assert.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 #if !defined(NO_PARMETIS_SUPPORT)
@@ -103,6 +105,9 @@ namespace Ioss {
     std::vector<int> importMap;
     std::vector<int> importCount;
     std::vector<int> importIndex;
+
+    // Neighbor exchange for the export/import data above; defined on first use.
+    mutable NeighborExchange exchange;
   };
 
   class SetDecompositionData
@@ -156,6 +161,9 @@ namespace Ioss {
     size_t file_node_offset() const { return m_nodeOffset; }
     size_t file_elem_offset() const { return m_elementOffset; }
 
+    // True if the method partitions by element centroids; the
+    // coordinates are then also part of the decomposition cache key.
+    bool uses_coordinates() const;
     bool needs_centroids() const;
 
     void generate_entity_distributions(size_t globalNodeCount, size_t globalElementCount);
@@ -171,7 +179,8 @@ namespace Ioss {
     bool i_own_elem(size_t global_index) const
     {
       // global_index is 1-based index into global list of elements [1..global_element_count]
-      return elemGTL.count(global_index) != 0;
+      auto I = lower_bound(elemGTL.begin(), elemGTL.end(), global_index, GTLCompare());
+      return I != elemGTL.end() && (size_t)I->first == global_index;
     }
 
     size_t node_global_to_local(size_t global_index) const
@@ -192,8 +201,8 @@ namespace Ioss {
       // global_index is 1-based index into global list of elements [1..global_node_count]
       // return value is 1-based index into local list of elements on this
       // processor (ioss-decomposition)
-      typename std::map<INT, INT>::const_iterator I = elemGTL.find(global_index);
-      assert(I != elemGTL.end());
+      auto I = lower_bound(elemGTL.begin(), elemGTL.end(), global_index, GTLCompare());
+      assert(I != elemGTL.end() && (size_t)I->first == global_index);
       return I->second;
     }
 
@@ -213,8 +222,23 @@ namespace Ioss {
 #endif
         std::vector<BlockDecompositionData> &element_blocks);
 
+    // If the DECOMPOSITION_CACHE property is set, read the
+    // decomposition written by an earlier run on the same mesh and
+    // processor count.  Call after the adjacency list is generated
+    // with this processor's file coordinates if uses_coordinates()
+    // (otherwise they are ignored); returns true if a matching plan
+    // was read, in which case decompose_model() does not partition
+    // the model again.
+    bool read_decomposition_cache(const std::vector<double> &x, const std::vector<double> &y,
+                                  const std::vector<double> &z);
+    void write_decomposition_cache();
+
     void simple_decompose();
 
+    void sfc_decompose();
+
+    template <typename P> void get_element_lists(const std::vector<P> &elem_partition);
+
     void simple_node_decompose();
 
     void calculate_element_centroids(const std::vector<double> &x, const std::vector<double> &y,
@@ -277,6 +301,11 @@ namespace Ioss {
     bool m_showProgress;
     bool m_showHWM;
 
+    std::string m_cacheFile;         // DECOMPOSITION_CACHE; empty if not caching
+    bool        m_cacheRead{false};  // The plan was read from m_cacheFile
+    bool        m_cacheTried{false}; // read_decomposition_cache() has been called
+    uint64_t    m_coordinateKey{0};  // Hash of the file coordinates if uses_coordinates()
+
     std::vector<double> m_centroids;
     std::vector<INT>    m_pointer;   // Index into adjacency, processor list for each element...
     std::vector<INT>    m_adjacency; // Size is sum of element connectivity sizes
@@ -352,12 +381,33 @@ namespace Ioss {
 
     std::vector<INT> localNodeMap;
 
+    // Neighbor exchanges for the element and node export/import data
+    // above; defined on first use and reused for every field.
+    mutable NeighborExchange m_elementExchange;
+    mutable NeighborExchange m_nodeExchange;
+
+    // The vectors above (and nodeGTL, m_nodeCommMap) in the order
+    // they are stored in a decomposition cache file.
+    std::vector<std::vector<INT> *> cached_vectors();
+    uint64_t                        cache_key() const;
+    std::vector<uint64_t>           cache_header() const;
+
     std::vector<INT> m_elementDist;
     std::vector<INT> m_nodeDist;
 
     // Note that nodeGTL is a sorted vector.
-    std::vector<INT>   nodeGTL; // Convert from global index to local index (1-based)
-    std::map<INT, INT> elemGTL; // Convert from global index to local index (1-based)
+    std::vector<INT> nodeGTL; // Convert from global index to local index (1-based)
+
+    // elemGTL is a vector of <global index, local index (1-based)> sorted on global index.
+    std::vector<std::pair<INT, INT>> elemGTL;
+
+    struct GTLCompare
+    {
+      bool operator()(const std::pair<INT, INT> &lhs, size_t global_index) const
+      {
+        return (size_t)lhs.first < global_index;
+      }
+    };
   };
 } // namespace Ioss
 #endif
@@ -35,6 +35,7 @@ RESTART_DECOMPOSITION_METHOD | {method} | Decompose a DB with type `RESTART_IN`
 DECOMPOSITION_METHOD | {method} | Decompose all input DB using `method`
 PARALLEL_CONSISTENCY | [on]/off | On if the client will call Ioss functions consistently on all processors. If off, then the auto-decomp and auto-join cannot be used.
 RETAIN_FREE_NODES | [on]/off | In auto-decomp, will nodes not connected to any elements be retained. 
+DECOMPOSITION_CACHE | {basename} | In auto-decomp, reuse the decomposition stored in `basename.{proc_count}.{proc}` if it matches the mesh connectivity, processor count, and method; otherwise decompose and write it there.
 LOAD_BALANCE_THRESHOLD | {real} [1.4] | CGNS-Structured only -- Load imbalance permitted Load on Proc / Avg Load
 
 ### Valid values for Decomposition Method
@@ -44,6 +45,8 @@ Method     | Description
 rcb        | recursive coordinate bisection
 rib        | recursive inertial bisection
 hsfc       | hilbert space-filling curve 
+hilbert    | hilbert space-filling curve; built in, does not need zoltan
+morton     | morton (z-order) space-filling curve; built in, does not need zoltan
 metis_sfc  | metis space-filling-curve 
 kway       | metis kway graph-based 
 kway_geom  | metis kway graph-based method with geometry speedup
@@ -37,8 +37,8 @@
 #include <array>
 #include <cassert>
 #include <cstddef> // for size_t
-#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace Ioss {
   class Region;
@@ -65,11 +65,6 @@ namespace Ioss {
     std::array<size_t, 4> connectivity_{};
   };
 
-  struct FaceHash
-  {
-    size_t operator()(const Face &face) const { return face.id_; }
-  };
-
   struct FaceEqual
   {
     bool operator()(const Face &left, const Face &right) const
@@ -90,18 +85,38 @@ namespace Ioss {
     }
   };
 
-  using FaceUnorderedSet = std::unordered_set<Face, FaceHash, FaceEqual>;
+  // Sorted on id_.
+  using FaceVector = std::vector<Face>;
+
   class FaceGenerator
   {
   public:
     explicit FaceGenerator(Ioss::Region &region);
 
-    template <typename INT> void generate_faces(INT /*dummy*/);
-    FaceUnorderedSet &           faces() { return faces_; }
+    // Generates the faces of the continuum elements.  The faces are
+    // collected in 'thread_count' ranges of face ids, each in its own
+    // open-addressing table filled by its own thread.
+    //
+    // If 'boundary_only' is true, a face is removed from its table as
+    // soon as its second element is found, so only the faces with a
+    // single element on this processor (exterior and processor
+    // boundary faces) are kept.  This is all a skin needs and takes
+    // much less memory; removed_face_count() gives the number of
+    // interior faces that were removed.
+    template <typename INT>
+    void generate_faces(INT /*dummy*/, bool boundary_only = false, int thread_count = 1);
+
+    FaceVector &faces() { return faces_; }
+    size_t      removed_face_count() const { return removedFaceCount_; }
+
+    // Largest memory (bytes) used by the face tables and face list.
+    size_t peak_memory() const { return peakMemory_; }
 
   private:
-    Ioss::Region &   region_;
-    FaceUnorderedSet faces_;
+    Ioss::Region &region_;
+    FaceVector    faces_;
+    size_t        removedFaceCount_{0};
+    size_t        peakMemory_{0};
   };
 } // namespace Ioss
 
@@ -163,6 +163,11 @@ namespace Ioss {
     bool transform(void *data);
     bool has_transform() const { return !transforms_.empty(); }
 
+    // Number of threads used by transform() when the transforms can be
+    // run as one pass over the data (see Transform::execute_chain).
+    void set_transform_thread_count(int count) { transformThreadCount_ = count; }
+    int  transform_thread_count() const { return transformThreadCount_; }
+
   private:
     std::string name_;
 
@@ -178,6 +183,7 @@ namespace Ioss {
     const VariableType *transStorage_{}; // Storage type after transformation
 
     std::vector<Transform *> transforms_;
+    int                      transformThreadCount_{1};
   };
 } // namespace Ioss
 #endif
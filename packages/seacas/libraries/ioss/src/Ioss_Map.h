@@ -72,6 +72,10 @@ namespace Ioss {
 
     int64_t global_to_local(int64_t global, bool must_exist = true) const;
 
+    // Batch version -- converts the `count` global ids in `data` to local ids in place.
+    template <typename INT>
+    void global_to_local(INT *data, size_t count, bool must_exist = true) const;
+
     template <typename INT>
     bool set_map(INT *ids, size_t count, size_t offset, bool in_define_mode = true);
 
@@ -98,6 +102,16 @@ namespace Ioss {
     bool defined() const { return m_defined; }
     void set_defined(bool yes_no) { m_defined = yes_no; }
 
+    // If true, the global to local reverse map is stored in an
+    // open-addressing hash table instead of a sorted vector.  Lookups
+    // are O(1) and partial maps are inserted without re-merging, at
+    // the cost of more memory (load factor <= 0.5).
+    bool use_hash() const { return m_useHash; }
+    void set_use_hash(bool yes_no);
+
+    // Number of bytes currently allocated for the reverse map.
+    size_t reverse_map_bytes() const;
+
   private:
     template <typename INT> void reverse_map_data(INT *data, size_t count) const;
     template <typename INT> void map_data(INT *data, size_t count) const;
@@ -106,7 +120,12 @@ namespace Ioss {
     int64_t global_to_local__(int64_t global, bool must_exist = true) const;
     void    build_reorder_map__(int64_t start, int64_t count);
     void    build_reverse_map__(int64_t num_to_get, int64_t offset);
+    void    build_reverse_hash__(int64_t num_to_get, int64_t offset);
     void    verify_no_duplicate_ids(std::vector<Ioss::IdPair> &reverse_map);
+    bool    reverse_empty() const { return m_useHash ? m_hashCount == 0 : m_reverse.empty(); }
+    void    hash_insert(int64_t global, int64_t local);
+    void    hash_resize(size_t capacity);
+    int64_t hash_find(int64_t global) const;
 
 #if defined(IOSS_THREADSAFE)
     mutable std::mutex m_;
@@ -114,11 +133,15 @@ namespace Ioss {
     MapContainer        m_map;
     MapContainer        m_reorder;
     ReverseMapContainer m_reverse;
+    ReverseMapContainer m_hash; // Open-addressing table; global id 0 marks an empty slot.
+    size_t              m_hashCount{0};
+    int                 m_hashShift{64};
     std::string         m_entityType{"unknown"}; // node, element, edge, face
     std::string         m_filename{"undefined"}; // For error messages only.
     int64_t             m_offset{-1};            // local to global offset if m_map is sequential.
     int                 m_myProcessor{0};        // For error messages...
     bool m_defined{false}; // For use by some clients; not all, so don't read too much into value...
+    bool m_useHash{false};
   };
 } // namespace Ioss
 
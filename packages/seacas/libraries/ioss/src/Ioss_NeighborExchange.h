@@ -0,0 +1,307 @@
+// Copyright(C) 1999-2017 National Technology & Engineering Solutions
+// of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+// NTESS, the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of NTESS nor the names of its
+//       contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IOSS_Ioss_NeighborExchange_h
+#define IOSS_Ioss_NeighborExchange_h
+
+#include <Ioss_CodeTypes.h>
+#include <Ioss_ParallelUtils.h>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#ifdef SEACAS_HAVE_MPI
+namespace Ioss {
+
+  /*! Sparse replacement for MY_Alltoallv when each processor only
+   * exchanges data with a few neighbors.
+   *
+   * define() scans the dense per-processor counts and displacements
+   * once and keeps only the processors with data to send or receive.
+   * Each exchange() then posts one nonblocking receive and send per
+   * neighbor instead of touching every processor.
+   *
+   * The data layout is the same as for MY_Alltoallv: the items for
+   * processor 'p' start at 'disp[p]' and each item has 'comp_count'
+   * components.  The caller fills the send buffer in 'pack' and reads
+   * the received data in 'unpack'.
+   *
+   * The first exchange of a datatype and component count uses
+   * temporary buffers.  If the same kind of exchange is repeated (the
+   * next field or time step), its buffers are kept and persistent
+   * requests are created for them, so later exchanges only need
+   * MPI_Startall and MPI_Waitall.
+   */
+  class NeighborExchange
+  {
+  public:
+    NeighborExchange() = default;
+
+    // Copies the neighbor lists; the buffers and persistent requests
+    // belong to the original.
+    NeighborExchange(const NeighborExchange &other)
+        : sends_(other.sends_), recvs_(other.recvs_), self_(other.self_),
+          sendSize_(other.sendSize_), recvSize_(other.recvSize_), comm_(other.comm_),
+          defined_(other.defined_)
+    {
+    }
+
+    NeighborExchange &operator=(const NeighborExchange &other)
+    {
+      if (this != &other) {
+        free_channels();
+        sends_    = other.sends_;
+        recvs_    = other.recvs_;
+        self_     = other.self_;
+        sendSize_ = other.sendSize_;
+        recvSize_ = other.recvSize_;
+        comm_     = other.comm_;
+        defined_  = other.defined_;
+      }
+      return *this;
+    }
+
+    ~NeighborExchange() { free_channels(); }
+
+    template <typename INT>
+    void define(const std::vector<INT> &send_count, const std::vector<INT> &send_disp,
+                const std::vector<INT> &recv_count, const std::vector<INT> &recv_disp,
+                MPI_Comm comm)
+    {
+      free_channels();
+      sends_.clear();
+      recvs_.clear();
+      sendSize_ = 0;
+      recvSize_ = 0;
+      comm_     = comm;
+
+      int my_processor = 0;
+      MPI_Comm_rank(comm, &my_processor);
+      int processor_count = static_cast<int>(send_count.size());
+      for (int p = 0; p < processor_count; p++) {
+        sendSize_ = std::max(sendSize_, static_cast<int64_t>(send_disp[p] + send_count[p]));
+        recvSize_ = std::max(recvSize_, static_cast<int64_t>(recv_disp[p] + recv_count[p]));
+        if (p == my_processor) {
+          self_ = Neighbor{p, static_cast<int64_t>(send_count[p]),
+                           static_cast<int64_t>(send_disp[p]), static_cast<int64_t>(recv_disp[p])};
+          continue;
+        }
+        if (send_count[p] > 0) {
+          sends_.push_back(
+              Neighbor{p, static_cast<int64_t>(send_count[p]), static_cast<int64_t>(send_disp[p]), 0});
+        }
+        if (recv_count[p] > 0) {
+          recvs_.push_back(
+              Neighbor{p, static_cast<int64_t>(recv_count[p]), static_cast<int64_t>(recv_disp[p]), 0});
+        }
+      }
+      defined_ = true;
+    }
+
+    bool   defined() const { return defined_; }
+    size_t send_neighbor_count() const { return sends_.size(); }
+    size_t recv_neighbor_count() const { return recvs_.size(); }
+
+    template <typename T, typename PACK, typename UNPACK>
+    void exchange(size_t comp_count, PACK pack, UNPACK unpack) const
+    {
+      assert(defined_);
+      MPI_Datatype type    = mpi_type(T(0));
+      Channel &    channel = get_channel(type, comp_count);
+
+      if (channel.uses++ == 0) {
+        std::vector<T>           send(sendSize_ * comp_count);
+        std::vector<T>           recv(recvSize_ * comp_count);
+        std::vector<MPI_Request> requests;
+        post_receives(recv.data(), type, comp_count, sizeof(T), requests, false);
+        pack(send.data());
+        post_sends(send.data(), type, comp_count, sizeof(T), requests, false);
+        copy_self(send.data(), recv.data(), comp_count, sizeof(T));
+        MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+        unpack(recv.data());
+        return;
+      }
+
+      if (!channel.persistent) {
+        channel.send.resize(sendSize_ * comp_count * sizeof(T));
+        channel.recv.resize(recvSize_ * comp_count * sizeof(T));
+        post_receives(channel.recv.data(), type, comp_count, sizeof(T), channel.requests, true);
+        post_sends(channel.send.data(), type, comp_count, sizeof(T), channel.requests, true);
+        channel.persistent = true;
+      }
+
+      T *  send      = reinterpret_cast<T *>(channel.send.data());
+      T *  recv      = reinterpret_cast<T *>(channel.recv.data());
+      auto recv_reqs = static_cast<int>(recvs_.size());
+      auto send_reqs = static_cast<int>(sends_.size());
+      if (recv_reqs > 0) {
+        MPI_Startall(recv_reqs, channel.requests.data());
+      }
+      pack(send);
+      if (send_reqs > 0) {
+        MPI_Startall(send_reqs, channel.requests.data() + recv_reqs);
+      }
+      copy_self(send, recv, comp_count, sizeof(T));
+      MPI_Waitall(recv_reqs + send_reqs, channel.requests.data(), MPI_STATUSES_IGNORE);
+      unpack(recv);
+    }
+
+  private:
+    struct Neighbor
+    {
+      int     proc;
+      int64_t count;
+      int64_t disp;
+      int64_t recv_disp; // Only used for the self entry.
+    };
+
+    struct Channel
+    {
+      MPI_Datatype             type;
+      size_t                   comp_count;
+      size_t                   uses{0};
+      bool                     persistent{false};
+      std::vector<char>        send;
+      std::vector<char>        recv;
+      std::vector<MPI_Request> requests; // receives first, then sends
+    };
+
+    Channel &get_channel(MPI_Datatype type, size_t comp_count) const
+    {
+      for (auto &channel : channels_) {
+        if (channel.type == type && channel.comp_count == comp_count) {
+          return channel;
+        }
+      }
+      channels_.emplace_back();
+      channels_.back().type       = type;
+      channels_.back().comp_count = comp_count;
+      return channels_.back();
+    }
+
+    int message_size(const Neighbor &neighbor, size_t comp_count) const
+    {
+      int64_t count = neighbor.count * comp_count;
+      int     size  = static_cast<int>(count);
+      if (static_cast<int64_t>(size) != count) {
+        int my_processor = 0;
+        MPI_Comm_rank(comm_, &my_processor);
+        std::ostringstream errmsg;
+        errmsg << "ERROR: The number of items that must be communicated via MPI calls between\n"
+               << "       processor " << my_processor << " and processor " << neighbor.proc
+               << " is " << count
+               << "\n       which exceeds the storage capacity of the integers "
+                  "used by MPI functions.\n";
+        std::cerr << errmsg.str();
+        exit(EXIT_FAILURE);
+      }
+      return size;
+    }
+
+    void post_receives(void *buffer, MPI_Datatype type, size_t comp_count, size_t type_size,
+                       std::vector<MPI_Request> &requests, bool persistent) const
+    {
+      for (const auto &neighbor : recvs_) {
+        char *data = static_cast<char *>(buffer) + neighbor.disp * comp_count * type_size;
+        requests.emplace_back();
+        if (persistent) {
+          MPI_Recv_init(data, message_size(neighbor, comp_count), type, neighbor.proc, tag, comm_,
+                        &requests.back());
+        }
+        else {
+          MPI_Irecv(data, message_size(neighbor, comp_count), type, neighbor.proc, tag, comm_,
+                    &requests.back());
+        }
+      }
+    }
+
+    void post_sends(void *buffer, MPI_Datatype type, size_t comp_count, size_t type_size,
+                    std::vector<MPI_Request> &requests, bool persistent) const
+    {
+      for (const auto &neighbor : sends_) {
+        char *data = static_cast<char *>(buffer) + neighbor.disp * comp_count * type_size;
+        requests.emplace_back();
+        if (persistent) {
+          MPI_Send_init(data, message_size(neighbor, comp_count), type, neighbor.proc, tag, comm_,
+                        &requests.back());
+        }
+        else {
+          MPI_Isend(data, message_size(neighbor, comp_count), type, neighbor.proc, tag, comm_,
+                    &requests.back());
+        }
+      }
+    }
+
+    void copy_self(const void *send, void *recv, size_t comp_count, size_t type_size) const
+    {
+      if (self_.count > 0) {
+        std::memcpy(static_cast<char *>(recv) + self_.recv_disp * comp_count * type_size,
+                    static_cast<const char *>(send) + self_.disp * comp_count * type_size,
+                    self_.count * comp_count * type_size);
+      }
+    }
+
+    void free_channels()
+    {
+      int finalized = 0;
+      MPI_Finalized(&finalized);
+      if (finalized == 0) {
+        for (auto &channel : channels_) {
+          for (auto &request : channel.requests) {
+            MPI_Request_free(&request);
+          }
+        }
+      }
+      channels_.clear();
+    }
+
+    static constexpr int tag = 24714;
+
+    std::vector<Neighbor> sends_;
+    std::vector<Neighbor> recvs_;
+    Neighbor              self_{0, 0, 0, 0};
+    int64_t               sendSize_{0};
+    int64_t               recvSize_{0};
+    MPI_Comm              comm_{MPI_COMM_NULL};
+    bool                  defined_{false};
+
+    mutable std::vector<Channel> channels_;
+  };
+} // namespace Ioss
+#endif
+#endif
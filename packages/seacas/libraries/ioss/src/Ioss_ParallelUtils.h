@@ -168,37 +168,30 @@ namespace Ioss {
       }
     }
 
-    size_t pow_2 = Ioss::Utils::power_2(processor_count);
-
-    for (size_t i = 1; i < pow_2; i++) {
-      MPI_Status status{};
-
-      int    tag           = 24713;
-      size_t exchange_proc = i ^ my_processor;
-      if (exchange_proc < static_cast<size_t>(processor_count)) {
-        int snd_cnt = static_cast<int>(
-            sendcounts[exchange_proc]); // Converts from int64_t to int as needed by mpi
-        int rcv_cnt = static_cast<int>(recvcounts[exchange_proc]);
-        if (static_cast<size_t>(my_processor) < exchange_proc) {
-          MPI_Send((void *)&sendbuf[senddisp[exchange_proc]], snd_cnt, mpi_type(T(0)),
-                   exchange_proc, tag, comm);
-          MPI_Recv(&recvbuf[recvdisp[exchange_proc]], rcv_cnt, mpi_type(T(0)), exchange_proc, tag,
-                   comm, &status);
-        }
-        else {
-          MPI_Recv(&recvbuf[recvdisp[exchange_proc]], rcv_cnt, mpi_type(T(0)), exchange_proc, tag,
-                   comm, &status);
-          MPI_Send((void *)&sendbuf[senddisp[exchange_proc]], snd_cnt, mpi_type(T(0)),
-                   exchange_proc, tag, comm);
-        }
+    // Only the processors with data to send or receive are contacted;
+    // all receives and sends are posted before waiting on any of them.
+    int                      tag = 24713;
+    std::vector<MPI_Request> requests;
+    for (int i = 0; i < processor_count; i++) {
+      if (i != my_processor && recvcounts[i] > 0) {
+        requests.emplace_back();
+        MPI_Irecv(&recvbuf[recvdisp[i]], static_cast<int>(recvcounts[i]), mpi_type(T(0)), i, tag,
+                  comm, &requests.back());
+      }
+    }
+    for (int i = 0; i < processor_count; i++) {
+      if (i != my_processor && sendcounts[i] > 0) {
+        requests.emplace_back();
+        MPI_Isend((void *)&sendbuf[senddisp[i]], static_cast<int>(sendcounts[i]), mpi_type(T(0)),
+                  i, tag, comm, &requests.back());
       }
     }
 
     // Take care of this processor's data movement...
-    std::copy(&sendbuf[senddisp[my_processor]],
-              &sendbuf[senddisp[my_processor] + sendcounts[my_processor]],
-              &recvbuf[recvdisp[my_processor]]);
-    return 0;
+    std::copy(sendbuf.begin() + senddisp[my_processor],
+              sendbuf.begin() + senddisp[my_processor] + sendcounts[my_processor],
+              recvbuf.begin() + recvdisp[my_processor]);
+    return MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
   }
 
   template <typename T>
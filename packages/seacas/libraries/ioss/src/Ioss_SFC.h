@@ -0,0 +1,102 @@
+// Copyright(C) 1999-2017 National Technology & Engineering Solutions
+// of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+// NTESS, the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//
+//     * Neither the name of NTESS nor the names of its
+//       contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IOSS_Ioss_SFC_h
+#define IOSS_Ioss_SFC_h
+
+#include <cstdint>
+
+// Keys of the space-filling curves used by the HILBERT and MORTON
+// decomposition methods and by slice.  Each coordinate of 'x' is an
+// integer of 'bits' bits and the key interleaves 'dim' * 'bits' bits,
+// so 'dim' * 'bits' must not exceed 64.
+
+namespace Ioss {
+  namespace SFC {
+    // Position of the point 'x' along the Hilbert curve through a 2^bits
+    // cube, using Skilling's transpose algorithm ("Programming the Hilbert
+    // curve", AIP Conf. Proc. 707, 2004).  'x' is overwritten.
+    inline uint64_t hilbert_key(uint32_t x[3], int dim, int bits)
+    {
+      uint32_t m = 1u << (bits - 1);
+      // Inverse undo
+      for (uint32_t q = m; q > 1; q >>= 1) {
+        uint32_t p = q - 1;
+        for (int i = 0; i < dim; i++) {
+          if (x[i] & q) {
+            x[0] ^= p;
+          }
+          else {
+            uint32_t t = (x[0] ^ x[i]) & p;
+            x[0] ^= t;
+            x[i] ^= t;
+          }
+        }
+      }
+      // Gray encode
+      for (int i = 1; i < dim; i++) {
+        x[i] ^= x[i - 1];
+      }
+      uint32_t t = 0;
+      for (uint32_t q = m; q > 1; q >>= 1) {
+        if (x[dim - 1] & q) {
+          t ^= q - 1;
+        }
+      }
+      for (int i = 0; i < dim; i++) {
+        x[i] ^= t;
+      }
+
+      // The key interleaves the transposed bits, most significant first.
+      uint64_t key = 0;
+      for (int b = bits - 1; b >= 0; b--) {
+        for (int i = 0; i < dim; i++) {
+          key = (key << 1) | ((x[i] >> b) & 1u);
+        }
+      }
+      return key;
+    }
+
+    // Position of the point 'x' along the Morton (Z-order) curve.
+    inline uint64_t morton_key(const uint32_t x[3], int dim, int bits)
+    {
+      uint64_t key = 0;
+      for (int b = bits - 1; b >= 0; b--) {
+        for (int i = 0; i < dim; i++) {
+          key = (key << 1) | ((x[i] >> b) & 1u);
+        }
+      }
+      return key;
+    }
+  } // namespace SFC
+} // namespace Ioss
+#endif
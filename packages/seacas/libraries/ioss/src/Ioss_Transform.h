@@ -34,14 +34,14 @@
 #define IOSS_Ioss_Transform_h
 
 #include <Ioss_CodeTypes.h>
-#include <functional> // for less
+#include <Ioss_Field.h> // for Field, Field::BasicType
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t
+#include <functional>   // for less
 #include <map>        // for map, map<>::value_compare
 #include <string>     // for string
 #include <vector>     // for vector
 
-namespace Ioss {
-  class Field;
-} // namespace Ioss
 namespace Ioss {
   class VariableType;
 } // namespace Ioss
@@ -66,6 +66,38 @@ namespace Ioss {
     virtual void set_properties(const std::string &name, const std::vector<int> &values);
     virtual void set_properties(const std::string &name, const std::vector<double> &values);
 
+    // Entity kernels.  A transform whose output for an entity only
+    // depends on the input values of that entity (and which does not
+    // change the entity count) returns true from has_kernel() for the
+    // types it supports.  kernel() transforms 'count' entities of
+    // 'components' values each from 'in' to 'out'.  'out' may be the
+    // same as 'in' if the transform does not add components;
+    // otherwise they must not overlap.
+    virtual bool has_kernel(Ioss::Field::BasicType type) const;
+    virtual void kernel(const double *in, double *out, size_t count, int components) const;
+    virtual void kernel(const int *in, int *out, size_t count, int components) const;
+    virtual void kernel(const int64_t *in, int64_t *out, size_t count, int components) const;
+
+    // Reductions.  A transform that reduces all values of a field to a
+    // single value returns true from has_reduction() for the types it
+    // supports.  reduce() combines 'count' values into 'value', which
+    // already holds a valid partial result (for example the first
+    // value).  Partial results are combined in order with reduce().
+    virtual bool has_reduction(Ioss::Field::BasicType type) const;
+    virtual void reduce(const double *values, size_t count, double &value) const;
+    virtual void reduce(const int *values, size_t count, int &value) const;
+    virtual void reduce(const int64_t *values, size_t count, int64_t &value) const;
+
+    // Runs 'chain' on 'data' ('count' entities stored as 'storage') in
+    // a single pass over memory.  The entities are processed in small
+    // blocks which stay in cache between the transforms, and are split
+    // among 'thread_count' threads.  Every transform must have a
+    // kernel, except that the last one may have a reduction instead.
+    // Returns false, without touching 'data', if that is not the case.
+    static bool execute_chain(const std::vector<Transform *> &chain, Ioss::Field::BasicType type,
+                              const Ioss::VariableType *storage, size_t count, void *data,
+                              int thread_count = 1);
+
   protected:
     Transform();
 
@@ -34,6 +34,7 @@
 #ifndef IOSS_Ioex_DatabaseIO_h
 #define IOSS_Ioex_DatabaseIO_h
 
+#include <Ioss_AsyncWriter.h>
 #include <Ioss_DBUsage.h>
 #include <Ioss_DatabaseIO.h>
 #include <Ioss_Field.h>
@@ -46,6 +47,7 @@
 #include <cstdint>
 #include <ctime>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
@@ -207,6 +209,8 @@ namespace Ioex {
     virtual void write_meta_data() = 0;
     void         write_results_metadata();
 
+    void finalize_database() override;
+
     void openDatabase__() const override { get_file_pointer(); }
 
     void closeDatabase__() const override { free_file_pointer(); }
@@ -218,6 +222,13 @@ namespace Ioex {
   protected:
     virtual int free_file_pointer() const; // Close file and set exodusFilePtr.
 
+    // Wait for all queued asynchronous output to complete (no-op if ASYNC_OUTPUT not enabled).
+    void fence_async_output() const;
+
+    // Returns the file pointer without waiting for queued asynchronous
+    // output.  Only valid for calls which are themselves queued.
+    int get_async_file_pointer() const;
+
     int  get_current_state() const; // Get current state with error checks and usage message.
     void put_qa();
     void put_info();
@@ -261,6 +272,7 @@ namespace Ioex {
 
     void flush_database__() const override;
     void finalize_write(double sim_time);
+    bool flush_interval_elapsed();
 
     // Private member data...
   protected:
@@ -301,6 +313,10 @@ namespace Ioex {
 
     mutable ValueContainer globalValues;
 
+    // Non-null if the ASYNC_OUTPUT property is enabled.  Transient
+    // output is copied into tasks executed by this writer.
+    std::unique_ptr<Ioss::AsyncWriter> asyncWriter;
+
     mutable std::vector<unsigned char> nodeConnectivityStatus;
 
     // For a database with omitted blocks, this map contains the indices of the
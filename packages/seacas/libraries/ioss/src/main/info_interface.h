@@ -56,6 +56,7 @@ namespace Info {
     bool adjacencies() const { return adjacencies_; }
     bool ints_64_bit() const { return ints64Bit_; }
     bool list_groups() const { return listGroups_; }
+    bool map_statistics() const { return mapStatistics_; }
 
     int  surface_split_scheme() const { return surfaceSplitScheme_; }
     char field_suffix_separator() const { return fieldSuffixSeparator_; }
@@ -83,6 +84,7 @@ namespace Info {
     bool ints64Bit_{false};
     bool computeBBox_{false};
     bool listGroups_{false};
+    bool mapStatistics_{false};
     bool useGenericNames_{false};
     char fieldSuffixSeparator_{'_'};
 
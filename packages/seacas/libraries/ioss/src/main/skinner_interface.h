@@ -72,6 +72,7 @@ namespace Skinner {
     std::string decomp_method;
     std::string compose_output;
     int         compression_level;
+    int         thread_count;
     bool        shuffle;
     bool        debug;
     bool        statistics;
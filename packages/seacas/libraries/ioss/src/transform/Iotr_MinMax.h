@@ -63,6 +63,11 @@ namespace Iotr {
     const Ioss::VariableType *output_storage(const Ioss::VariableType *in) const override;
     int                       output_count(int in) const override;
 
+    bool has_reduction(Ioss::Field::BasicType type) const override;
+    void reduce(const double *values, size_t count, double &value) const override;
+    void reduce(const int *values, size_t count, int &value) const override;
+    void reduce(const int64_t *values, size_t count, int64_t &value) const override;
+
   protected:
     explicit MinMax(const std::string &type);
 
@@ -67,6 +67,11 @@ namespace Iotr {
     void set_properties(const std::string &name, const std::vector<int> &values) override;
     void set_properties(const std::string &name, const std::vector<double> &values) override;
 
+    bool has_kernel(Ioss::Field::BasicType type) const override;
+    void kernel(const double *in, double *out, size_t count, int components) const override;
+    void kernel(const int *in, int *out, size_t count, int components) const override;
+    void kernel(const int64_t *in, int64_t *out, size_t count, int components) const override;
+
   protected:
     Offset3D();
 
@@ -66,6 +66,11 @@ namespace Iotr {
     void set_property(const std::string &name, int value) override;
     void set_property(const std::string &name, double value) override;
 
+    bool has_kernel(Ioss::Field::BasicType type) const override;
+    void kernel(const double *in, double *out, size_t count, int components) const override;
+    void kernel(const int *in, int *out, size_t count, int components) const override;
+    void kernel(const int64_t *in, int64_t *out, size_t count, int components) const override;
+
   protected:
     Scale();
 
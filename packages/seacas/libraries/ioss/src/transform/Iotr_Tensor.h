@@ -74,6 +74,10 @@ namespace Iotr {
     const Ioss::VariableType *output_storage(const Ioss::VariableType *in) const override;
     int                       output_count(int in) const override;
 
+    using Ioss::Transform::kernel;
+    bool has_kernel(Ioss::Field::BasicType type) const override;
+    void kernel(const double *in, double *out, size_t count, int components) const override;
+
   protected:
     explicit Tensor(const std::string &type);
 
@@ -0,0 +1,119 @@
+/*
+ * Copyright(C) 2010-2017 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above
+ *       copyright notice, this list of conditions and the following
+ *       disclaimer in the documentation and/or other materials provided
+ *       with the distribution.
+ *
+ *     * Neither the name of NTESS nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef SL_READ_AHEAD_H
+#define SL_READ_AHEAD_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace SLIB {
+
+  /*!
+   * Reads exodus files ahead of the (serial) exodus api calls of an
+   * application.
+   *
+   * The netcdf library is not thread-safe, so the exodus reads
+   * themselves stay on the main thread.  What can run concurrently is
+   * the file i/o itself: a pool of worker threads reads the byte ranges
+   * that the next phase will touch into per-thread scratch buffers, so
+   * that by the time the main thread gets to a file the data is in the
+   * page cache instead of being fetched from disk one file at a time.
+   *
+   * For netcdf classic, 64-bit offset and cdf5 files the header is
+   * parsed to find the start and size of the record section so that
+   * only the requested time step is read.  For other formats (netcdf-4)
+   * the whole file is hinted to the kernel instead.
+   *
+   * With a `thread_count` of zero, all requests are ignored.
+   */
+  class ReadAhead
+  {
+  public:
+    ReadAhead(int thread_count, std::vector<std::string> filenames);
+    ~ReadAhead();
+
+    //! Queue a read of the header and non-record data of every file.
+    void metadata();
+
+    //! Queue a read of the 0-based time step `step` of every file.
+    void step(int step);
+
+    //! Queue a read of the 0-based time step `step` of file `file`.
+    void step(int file, int step);
+
+    //! Block until all queued reads have completed.
+    void wait();
+
+    int thread_count() const { return static_cast<int>(workers_.size()); }
+
+  private:
+    struct Layout
+    {
+      bool    parsed{false};
+      bool    classic{false};
+      int64_t beginRecord{0}; //!< file offset of the first record
+      int64_t recordSize{0};  //!< bytes per record (time step)
+    };
+
+    struct Request
+    {
+      int file;
+      int step; //!< -1 means header and non-record data
+    };
+
+    void worker();
+    void process(const Request &request, std::vector<char> &buffer);
+
+    std::vector<std::string> filenames_;
+    std::vector<Layout>      layout_;
+    std::vector<std::thread> workers_;
+    std::deque<Request>      queue_;
+    std::mutex               mutex_;
+    std::condition_variable  haveWork_;
+    std::condition_variable  idle_;
+    int                      active_{0};
+    bool                     done_{false};
+
+    // Disable copying and assignment...
+    ReadAhead(const ReadAhead &);
+    ReadAhead operator=(const ReadAhead &);
+  };
+} // namespace SLIB
+#endif /* SL_READ_AHEAD_H */
@@ -0,0 +1,75 @@
+/*
+ * Copyright(C) 2010-2017 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above
+ *       copyright notice, this list of conditions and the following
+ *       disclaimer in the documentation and/or other materials provided
+ *       with the distribution.
+ *
+ *     * Neither the name of NTESS nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef SL_THREAD_RANGE_H
+#define SL_THREAD_RANGE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace SLIB {
+
+  /*!
+   * Calls `func(thread, begin, end)` on `nthreads` threads, each given
+   * one contiguous range of [0, count).  With a single thread, func is
+   * called directly.
+   */
+  template <typename FUNC> void for_each_range(int nthreads, size_t count, FUNC func)
+  {
+    if (nthreads <= 1) {
+      func(0, size_t(0), count);
+      return;
+    }
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nthreads; t++) {
+      threads.emplace_back(func, t, count * t / nthreads, count * (t + 1) / nthreads);
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  //! Number of threads to use for `count` items; a thread gets at least a few thousand items.
+  inline int range_thread_count(int num_threads, size_t count)
+  {
+    if (num_threads <= 1) {
+      return 1;
+    }
+    size_t max_threads = count / 4096 + 1;
+    return static_cast<int>(std::min(static_cast<size_t>(num_threads), max_threads));
+  }
+} // namespace SLIB
+#endif /* SL_THREAD_RANGE_H */
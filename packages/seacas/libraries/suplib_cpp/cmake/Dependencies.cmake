@@ -1,3 +1,5 @@
 TRIBITS_PACKAGE_DEFINE_DEPENDENCIES(
+  LIB_OPTIONAL_TPLS Pthread
 )
 
+TRIBITS_TPL_TENTATIVELY_ENABLE(Pthread)